@@ -1,12 +1,23 @@
 #pragma once
 
 #include <algorithm>
+#include <array>
+#include <cpp_pipelines/execution.hpp>
 #include <cpp_pipelines/functions.hpp>
+#include <cpp_pipelines/operators.hpp>
 #include <cpp_pipelines/pipeline.hpp>
+#include <cpp_pipelines/simd/compress.hpp>
+#include <cpp_pipelines/simd/reduce.hpp>
 #include <cpp_pipelines/subrange.hpp>
 #include <cpp_pipelines/type_traits.hpp>
+#include <cstdint>
+#include <cstring>
 #include <functional>
+#include <iterator>
+#include <limits>
 #include <numeric>
+#include <optional>
+#include <vector>
 
 namespace cpp_pipelines::algorithm
 {
@@ -241,6 +252,256 @@ Iter1 overwrite(Iter1 src_b, Iter1 src_e, Iter2 dst_b, Iter2 dst_e, Func func)
     return src_b;
 }
 
+template <class T>
+struct is_radix_key
+    : std::bool_constant<
+          (std::is_integral_v<T> && !std::is_same_v<T, bool>)
+          || (std::is_floating_point_v<T> && std::numeric_limits<T>::is_iec559 && (sizeof(T) == 4 || sizeof(T) == 8))>
+{
+};
+
+template <std::size_t Size>
+struct unsigned_of_size;
+
+template <>
+struct unsigned_of_size<1>
+{
+    using type = std::uint8_t;
+};
+
+template <>
+struct unsigned_of_size<2>
+{
+    using type = std::uint16_t;
+};
+
+template <>
+struct unsigned_of_size<4>
+{
+    using type = std::uint32_t;
+};
+
+template <>
+struct unsigned_of_size<8>
+{
+    using type = std::uint64_t;
+};
+
+// maps a key onto an unsigned integer of the same width whose ordering matches the ordering of the keys
+// (for floating point: -0.0 before 0.0, NaNs at the ends)
+template <class T>
+constexpr auto to_radix_key(T value)
+{
+    using U = typename unsigned_of_size<sizeof(T)>::type;
+    constexpr U sign = U{ 1 } << (sizeof(T) * 8 - 1);
+    if constexpr (std::is_floating_point_v<T>)
+    {
+        U bits = 0;
+        std::memcpy(&bits, &value, sizeof(T));
+        return static_cast<U>((bits & sign) ? ~bits : bits | sign);
+    }
+    else if constexpr (std::is_signed_v<T>)
+    {
+        return static_cast<U>(static_cast<U>(value) ^ sign);
+    }
+    else
+    {
+        return static_cast<U>(value);
+    }
+}
+
+// stable LSD radix sort of the element positions; the keys are extracted once, counted for every digit in a single
+// pass, and digits shared by all the keys are skipped
+template <class Iter, class Proj>
+std::vector<std::size_t> radix_argsort(Iter b, Iter e, Proj proj)
+{
+    using key_type = decltype(to_radix_key(invoke(proj, *b)));
+    using item_type = std::pair<key_type, std::size_t>;
+    constexpr std::size_t digits = sizeof(key_type);
+
+    std::vector<item_type> items;
+    items.reserve(static_cast<std::size_t>(std::distance(b, e)));
+    for (std::size_t index = 0; b != e; ++b, ++index)
+    {
+        items.emplace_back(to_radix_key(invoke(proj, *b)), index);
+    }
+
+    const auto digit = [](key_type key, std::size_t d) { return static_cast<std::size_t>((key >> (d * 8)) & 0xFF); };
+
+    std::vector<std::array<std::size_t, 256>> counts(digits);
+    for (const item_type& item : items)
+    {
+        for (std::size_t d = 0; d < digits; ++d)
+        {
+            ++counts[d][digit(item.first, d)];
+        }
+    }
+
+    std::vector<item_type> buffer(items.size());
+    for (std::size_t d = 0; d < digits; ++d)
+    {
+        std::array<std::size_t, 256>& offsets = counts[d];
+        if (std::find(offsets.begin(), offsets.end(), items.size()) != offsets.end())
+        {
+            continue;
+        }
+        std::exclusive_scan(offsets.begin(), offsets.end(), offsets.begin(), std::size_t{ 0 });
+        for (const item_type& item : items)
+        {
+            buffer[offsets[digit(item.first, d)]++] = item;
+        }
+        items.swap(buffer);
+    }
+
+    std::vector<std::size_t> result;
+    result.reserve(items.size());
+    for (const item_type& item : items)
+    {
+        result.push_back(item.second);
+    }
+    return result;
+}
+
+template <class Iter>
+void apply_permutation(Iter b, const std::vector<std::size_t>& order)
+{
+    std::vector<iter_value_t<Iter>> sorted;
+    sorted.reserve(order.size());
+    for (std::size_t index : order)
+    {
+        sorted.push_back(std::move(b[index]));
+    }
+    std::move(sorted.begin(), sorted.end(), b);
+}
+
+// contiguous ranges of arithmetic values, visited without projection, are handed to the simd kernels
+template <class Range, class Proj = identity_fn>
+static constexpr bool is_vectorizable_range = is_contiguous_range<Range>::value && std::is_same_v<Proj, identity_fn>
+                                              && simd::is_vectorizable<range_value_t<Range>>::value;
+
+template <class Op>
+struct flipped_comparison;
+
+template <>
+struct flipped_comparison<std::equal_to<>>
+{
+    using type = std::equal_to<>;
+};
+
+template <>
+struct flipped_comparison<std::not_equal_to<>>
+{
+    using type = std::not_equal_to<>;
+};
+
+template <>
+struct flipped_comparison<std::less<>>
+{
+    using type = std::greater<>;
+};
+
+template <>
+struct flipped_comparison<std::greater<>>
+{
+    using type = std::less<>;
+};
+
+template <>
+struct flipped_comparison<std::less_equal<>>
+{
+    using type = std::greater_equal<>;
+};
+
+template <>
+struct flipped_comparison<std::greater_equal<>>
+{
+    using type = std::less_equal<>;
+};
+
+// the operand is compared in the element type only when the conversion keeps its value
+template <class T, class U>
+std::optional<T> exact_conversion(const U& value)
+{
+    const auto result = static_cast<T>(value);
+    return static_cast<U>(result) == value ? std::optional<T>{ result } : std::nullopt;
+}
+
+// predicates like less(5), equal_to(x) or between(a, b), turned into the equivalent simd predicate over elements of
+// type T when their operands are exactly representable in it
+template <class Pred, class = void>
+struct vector_predicate : std::false_type
+{
+};
+
+template <class Op, class U, bool Left>
+struct vector_predicate<
+    pipeline_t<cpp_pipelines::detail::bound_operator<Op, U, Left>>,
+    std::void_t<typename flipped_comparison<Op>::type>> : std::true_type
+{
+    using operand_type = U;
+    using compare = std::conditional_t<Left, typename flipped_comparison<Op>::type, Op>;
+
+    template <class T>
+    static std::optional<simd::compare_with<compare, T>> make(
+        const pipeline_t<cpp_pipelines::detail::bound_operator<Op, U, Left>>& pred)
+    {
+        if (const auto value = exact_conversion<T>(std::get<0>(pred.pipes).value))
+        {
+            return simd::compare_with<compare, T>{ *value };
+        }
+        return std::nullopt;
+    }
+};
+
+template <class U>
+struct vector_predicate<pipeline_t<cpp_pipelines::detail::bound_interval<U>>> : std::true_type
+{
+    using operand_type = U;
+
+    template <class T>
+    static std::optional<simd::between<T>> make(const pipeline_t<cpp_pipelines::detail::bound_interval<U>>& pred)
+    {
+        const auto low = exact_conversion<T>(std::get<0>(pred.pipes).low);
+        const auto high = exact_conversion<T>(std::get<0>(pred.pipes).high);
+        if (low && high)
+        {
+            return simd::between<T>{ *low, *high };
+        }
+        return std::nullopt;
+    }
+};
+
+// the comparison in the element type gives the same result as the one in the common type: no integer compared to a
+// floating point operand, no signed integer converted to an unsigned one
+template <class Range, class Pred, class Proj, class = void>
+struct use_simd_predicate : std::false_type
+{
+};
+
+template <class Range, class Pred, class Proj>
+struct use_simd_predicate<Range, Pred, Proj, std::enable_if_t<vector_predicate<Pred>::value>>
+{
+    using value_type = range_value_t<Range>;
+    using operand_type = typename vector_predicate<Pred>::operand_type;
+    using common_type = std::common_type_t<value_type, operand_type>;
+
+    static constexpr bool value = is_vectorizable_range<Range, Proj> && (sizeof(value_type) == 4 || sizeof(value_type) == 8)
+                                  && simd::is_vectorizable<operand_type>::value
+                                  && !(std::is_integral_v<value_type> && std::is_floating_point_v<operand_type>)
+                                  && !(std::is_signed_v<value_type> && std::is_unsigned_v<common_type>);
+};
+
+template <class Range, class Pred>
+std::optional<std::ptrdiff_t> simd_count(Range& range, const Pred& pred)
+{
+    if (const auto test = vector_predicate<Pred>::template make<range_value_t<Range>>(pred))
+    {
+        const auto span = as_span(range);
+        return simd::count(span.begin(), span.end(), *test);
+    }
+    return std::nullopt;
+}
+
 }  // namespace detail
 
 template <class Range, class T, class BinaryFunc = std::plus<>, class Proj = identity_fn>
@@ -256,6 +517,30 @@ auto accumulate(Range&& range, T init, BinaryFunc func = {}, Proj proj = {})
         { return invoke(func, std::move(total), invoke(proj, std::forward<decltype(item)>(item))); });
 }
 
+template <class Range, class Compare = std::less<>, class Proj = identity_fn>
+std::vector<std::size_t> argsort(Range&& range, Compare compare = {}, Proj proj = {})
+{
+    CPP_PIPELINES_CHECK_CONSTRAINTS(range, is_random_access_range);
+
+    using key_type = std::decay_t<decltype(invoke(proj, *std::begin(range)))>;
+    // floating point keys keep the comparison sort, which treats -0.0 and 0.0 as equivalent
+    if constexpr (std::is_same_v<Compare, std::less<>> && std::is_integral_v<key_type> && !std::is_same_v<key_type, bool>)
+    {
+        return detail::radix_argsort(std::begin(range), std::end(range), std::ref(proj));
+    }
+    else
+    {
+        const auto b = std::begin(range);
+        std::vector<std::size_t> result(static_cast<std::size_t>(std::distance(b, std::end(range))));
+        std::iota(result.begin(), result.end(), std::size_t{ 0 });
+        std::stable_sort(
+            result.begin(),
+            result.end(),
+            [&](std::size_t lhs, std::size_t rhs) { return invoke(compare, invoke(proj, b[lhs]), invoke(proj, b[rhs])); });
+        return result;
+    }
+}
+
 template <class Range, class OutputIter, class BinaryFunc = std::minus<>, class Proj = identity_fn>
 auto adjacent_difference(Range&& range, OutputIter output, BinaryFunc func = {}, Proj proj = {})
 {
@@ -264,7 +549,7 @@ auto adjacent_difference(Range&& range, OutputIter output, BinaryFunc func = {},
     return detail::adjacent_difference(std::begin(range), std::end(range), output, std::ref(func), std::ref(proj));
 }
 
-template <class Range, class UnaryPred, class Proj = identity_fn>
+template <class Range, class UnaryPred, class Proj = identity_fn, class = execution::detail::disable_if_policy<Range>>
 auto all_of(Range&& range, UnaryPred pred, Proj proj = {})
 {
     CPP_PIPELINES_CHECK_CONSTRAINTS(range, is_input_range);
@@ -272,7 +557,7 @@ auto all_of(Range&& range, UnaryPred pred, Proj proj = {})
     return std::all_of(std::begin(range), std::end(range), fn(std::ref(proj), std::ref(pred)));
 }
 
-template <class Range, class UnaryPred, class Proj = identity_fn>
+template <class Range, class UnaryPred, class Proj = identity_fn, class = execution::detail::disable_if_policy<Range>>
 auto any_of(Range&& range, UnaryPred pred, Proj proj = {})
 {
     CPP_PIPELINES_CHECK_CONSTRAINTS(range, is_input_range);
@@ -288,14 +573,59 @@ auto copy(Range&& range, OutputIter output)
     return std::copy(std::begin(range), std::end(range), output);
 }
 
-template <class Range, class OutputIter, class UnaryPred, class Proj = identity_fn>
+template <
+    class Range,
+    class OutputIter,
+    class UnaryPred,
+    class Proj = identity_fn,
+    class = execution::detail::disable_if_policy<Range>>
 auto copy_if(Range&& range, OutputIter output, UnaryPred pred, Proj proj = {})
 {
     CPP_PIPELINES_CHECK_CONSTRAINTS(range, is_input_range);
 
+    if constexpr (detail::use_simd_predicate<Range, UnaryPred, Proj>::value)
+    {
+        using T = range_value_t<Range>;
+        if (const auto test = detail::vector_predicate<UnaryPred>::template make<T>(pred))
+        {
+            // compressed block by block into a buffer, as simd::compress stores more than the selected elements
+            std::array<T, 256> buffer;
+            const auto span = as_span(range);
+            for (auto b = span.begin(); b != span.end();)
+            {
+                const auto e = b + std::min<std::ptrdiff_t>(span.end() - b, buffer.size());
+                output = std::copy(buffer.data(), simd::compress(b, e, buffer.data(), *test), output);
+                b = e;
+            }
+            return output;
+        }
+    }
     return std::copy_if(std::begin(range), std::end(range), output, fn(std::ref(proj), std::ref(pred)));
 }
 
+// copy_if into a new vector; contiguous arithmetic ranges filtered by a comparison with a constant or by between(a, b)
+// are compressed with simd, without a branch per element
+template <class Range, class UnaryPred, class Proj = identity_fn>
+auto compress(Range&& range, UnaryPred pred, Proj proj = {}) -> std::vector<range_value_t<Range>>
+{
+    CPP_PIPELINES_CHECK_CONSTRAINTS(range, is_input_range);
+
+    std::vector<range_value_t<Range>> result;
+    if constexpr (detail::use_simd_predicate<Range, UnaryPred, Proj>::value)
+    {
+        if (const auto test = detail::vector_predicate<UnaryPred>::template make<range_value_t<Range>>(pred))
+        {
+            const auto span = as_span(range);
+            result.resize(span.end() - span.begin());
+            const auto end = simd::compress(span.begin(), span.end(), result.data(), *test);
+            result.resize(end - result.data());
+            return result;
+        }
+    }
+    copy_if(range, std::back_inserter(result), std::ref(pred), std::ref(proj));
+    return result;
+}
+
 template <class Range, class Size, class OutputIter>
 auto copy_n(Range&& range, Size size, OutputIter output)
 {
@@ -309,14 +639,28 @@ auto count(Range&& range, const T& value, Proj proj = {})
 {
     CPP_PIPELINES_CHECK_CONSTRAINTS(range, is_input_range);
 
+    if constexpr (detail::use_simd_predicate<Range, decltype(cpp_pipelines::equal_to(value)), Proj>::value)
+    {
+        if (const auto result = detail::simd_count(range, cpp_pipelines::equal_to(value)))
+        {
+            return static_cast<iter_difference_t<iterator_t<Range>>>(*result);
+        }
+    }
     return std::count_if(std::begin(range), std::end(range), fn(std::ref(proj), detail::equal_to(std::ref(value))));
 }
 
-template <class Range, class UnaryPred, class Proj = identity_fn>
+template <class Range, class UnaryPred, class Proj = identity_fn, class = execution::detail::disable_if_policy<Range>>
 auto count_if(Range&& range, UnaryPred pred, Proj proj = {})
 {
     CPP_PIPELINES_CHECK_CONSTRAINTS(range, is_input_range);
 
+    if constexpr (detail::use_simd_predicate<Range, UnaryPred, Proj>::value)
+    {
+        if (const auto result = detail::simd_count(range, pred))
+        {
+            return static_cast<iter_difference_t<iterator_t<Range>>>(*result);
+        }
+    }
     return std::count_if(std::begin(range), std::end(range), fn(std::ref(proj), std::ref(pred)));
 }
 
@@ -347,7 +691,13 @@ auto equal_range(Range&& range, const T& value, Compare compare = {}, Proj proj
     return detail::equal_range(std::begin(range), std::end(range), value, std::ref(compare), std::ref(proj));
 }
 
-template <class Range, class Output, class T, class BinaryFunc, class Proj = identity_fn>
+template <
+    class Range,
+    class Output,
+    class T,
+    class BinaryFunc,
+    class Proj = identity_fn,
+    class = execution::detail::disable_if_policy<Range>>
 auto exclusive_scan(Range&& range, Output output, T init, BinaryFunc func, Proj proj = {})
 {
     return std::transform_exclusive_scan(std::begin(range), std::end(range), output, init, std::ref(func), std::ref(proj));
@@ -372,7 +722,12 @@ decltype(auto) find(Range&& range, const T& value, Proj proj = {})
         [&](auto b, auto e) { return std::find_if(b, e, fn(std::ref(proj), detail::equal_to(std::ref(value)))); });
 }
 
-template <class Policy = default_return_policy, class Range, class UnaryPred, class Proj = identity_fn>
+template <
+    class Policy = default_return_policy,
+    class Range,
+    class UnaryPred,
+    class Proj = identity_fn,
+    class = execution::detail::disable_if_policy<Range>>
 decltype(auto) find_if(Range&& range, UnaryPred pred, Proj proj = {})
 {
     CPP_PIPELINES_CHECK_CONSTRAINTS(range, is_input_range);
@@ -446,7 +801,7 @@ decltype(auto) find_first_of(Range1&& range1, Range2&& range2, BinaryPred pred =
         });
 }
 
-template <class Range, class UnaryFunc, class Proj = identity_fn>
+template <class Range, class UnaryFunc, class Proj = identity_fn, class = execution::detail::disable_if_policy<Range>>
 auto for_each(Range&& range, UnaryFunc func, Proj proj = {})
 {
     CPP_PIPELINES_CHECK_CONSTRAINTS(range, is_input_range);
@@ -482,7 +837,12 @@ auto includes(Range1&& range1, Range2&& range2, Compare compare = {}, Proj1 proj
         detail::invoke_binary{ std::ref(compare), std::ref(proj1), std::ref(proj2) });
 }
 
-template <class Range, class Output, class BinaryFunc, class Proj = identity_fn>
+template <
+    class Range,
+    class Output,
+    class BinaryFunc,
+    class Proj = identity_fn,
+    class = execution::detail::disable_if_policy<Range>>
 auto inclusive_scan(Range&& range, Output output, BinaryFunc func, Proj proj = {})
 {
     return std::transform_inclusive_scan(std::begin(range), std::end(range), output, std::ref(func), std::ref(proj));
@@ -508,13 +868,25 @@ auto inner_product(
     CPP_PIPELINES_CHECK_CONSTRAINTS(range1, is_input_range);
     CPP_PIPELINES_CHECK_CONSTRAINTS(range2, is_input_range);
 
-    return std::inner_product(
-        std::begin(range1),
-        std::end(range1),
-        std::begin(range2),
-        init,
-        std::ref(func1),
-        detail::invoke_binary{ std::ref(func2), std::ref(proj1), std::ref(proj2) });
+    // integers only: unlike reduce, inner_product fixes the order of the additions
+    if constexpr (
+        detail::is_vectorizable_range<Range1, Proj1> && detail::is_vectorizable_range<Range2, Proj2>
+        && std::is_same_v<BinaryFunc1, std::plus<>> && std::is_same_v<BinaryFunc2, std::multiplies<>>
+        && std::is_integral_v<T> && std::is_same_v<T, range_value_t<Range1>> && std::is_same_v<T, range_value_t<Range2>>)
+    {
+        const auto span1 = as_span(range1);
+        return static_cast<T>(init + simd::dot(span1.begin(), span1.end(), as_span(range2).begin()));
+    }
+    else
+    {
+        return std::inner_product(
+            std::begin(range1),
+            std::end(range1),
+            std::begin(range2),
+            init,
+            std::ref(func1),
+            detail::invoke_binary{ std::ref(func2), std::ref(proj1), std::ref(proj2) });
+    }
 }
 
 template <class Range, class T>
@@ -634,8 +1006,24 @@ decltype(auto) max_element(Range&& range, Compare compare = {}, Proj proj = {})
     return detail::invoke_algorithm<Policy>(
         std::begin(range),
         std::end(range),
-        [&](auto b, auto e) {
-            return std::max_element(b, e, detail::invoke_binary{ std::ref(compare), std::ref(proj) });
+        [&](auto b, auto e)
+        {
+            if constexpr (
+                detail::is_vectorizable_range<Range, Proj> && std::is_same_v<Compare, std::less<>>
+                && std::is_integral_v<range_value_t<Range>>)
+            {
+                if (b == e)
+                {
+                    return e;
+                }
+                const auto span = as_span(range);
+                const auto value = simd::max(span.begin(), span.end());
+                return b + (std::find(span.begin(), span.end(), value) - span.begin());
+            }
+            else
+            {
+                return std::max_element(b, e, detail::invoke_binary{ std::ref(compare), std::ref(proj) });
+            }
         });
 }
 
@@ -688,8 +1076,24 @@ decltype(auto) min_element(Range&& range, Compare compare = {}, Proj proj = {})
     return detail::invoke_algorithm<Policy>(
         std::begin(range),
         std::end(range),
-        [&](auto b, auto e) {
-            return std::min_element(b, e, detail::invoke_binary{ std::ref(compare), std::ref(proj) });
+        [&](auto b, auto e)
+        {
+            if constexpr (
+                detail::is_vectorizable_range<Range, Proj> && std::is_same_v<Compare, std::less<>>
+                && std::is_integral_v<range_value_t<Range>>)
+            {
+                if (b == e)
+                {
+                    return e;
+                }
+                const auto span = as_span(range);
+                const auto value = simd::min(span.begin(), span.end());
+                return b + (std::find(span.begin(), span.end(), value) - span.begin());
+            }
+            else
+            {
+                return std::min_element(b, e, detail::invoke_binary{ std::ref(compare), std::ref(proj) });
+            }
         });
 }
 
@@ -729,7 +1133,7 @@ auto next_permutation(Range&& range, Compare compare = {}, Proj proj = {})
         std::begin(range), std::end(range), detail::invoke_binary{ std::ref(compare), std::ref(proj) });
 }
 
-template <class Range, class UnaryPred, class Proj = identity_fn>
+template <class Range, class UnaryPred, class Proj = identity_fn, class = execution::detail::disable_if_policy<Range>>
 auto none_of(Range&& range, UnaryPred pred, Proj proj = {})
 {
     CPP_PIPELINES_CHECK_CONSTRAINTS(range, is_input_range);
@@ -835,10 +1239,25 @@ void push_heap(Range&& range, Compare compare = {}, Proj proj = {})
     std::push_heap(std::begin(range), std::end(range), detail::invoke_binary{ std::ref(compare), std::ref(proj) });
 }
 
-template <class Range, class T, class BinaryFunc = std::plus<>, class Proj = identity_fn>
+template <
+    class Range,
+    class T,
+    class BinaryFunc = std::plus<>,
+    class Proj = identity_fn,
+    class = execution::detail::disable_if_policy<Range>>
 auto reduce(Range&& range, T init, BinaryFunc func = {}, Proj proj = {})
 {
-    return std::transform_reduce(std::begin(range), std::end(range), std::move(init), std::ref(func), std::ref(proj));
+    if constexpr (
+        detail::is_vectorizable_range<Range, Proj> && std::is_same_v<BinaryFunc, std::plus<>>
+        && std::is_same_v<T, range_value_t<Range>>)
+    {
+        const auto span = as_span(range);
+        return static_cast<T>(init + simd::sum(span.begin(), span.end()));
+    }
+    else
+    {
+        return std::transform_reduce(std::begin(range), std::end(range), std::move(init), std::ref(func), std::ref(proj));
+    }
 }
 
 template <class Policy = default_return_policy, class Range, class T, class Proj = identity_fn>
@@ -1125,7 +1544,22 @@ void shuffle(Range&& range, RandomNumberGenerator generator)
     std::shuffle(std::begin(range), std::end(range), std::move(generator));
 }
 
-template <class Range, class Compare = std::less<>, class Proj = identity_fn>
+template <class Range, class Proj = identity_fn>
+void radix_sort(Range&& range, Proj proj = {})
+{
+    CPP_PIPELINES_CHECK_CONSTRAINTS(range, is_random_access_range);
+
+    using key_type = std::decay_t<decltype(invoke(proj, *std::begin(range)))>;
+    static_assert(detail::is_radix_key<key_type>::value, "radix_sort: integral or floating point key required");
+
+    detail::apply_permutation(std::begin(range), detail::radix_argsort(std::begin(range), std::end(range), std::ref(proj)));
+}
+
+template <
+    class Range,
+    class Compare = std::less<>,
+    class Proj = identity_fn,
+    class = execution::detail::disable_if_policy<Range>>
 void sort(Range&& range, Compare compare = {}, Proj proj = {})
 {
     CPP_PIPELINES_CHECK_CONSTRAINTS(range, is_random_access_range);
@@ -1133,7 +1567,11 @@ void sort(Range&& range, Compare compare = {}, Proj proj = {})
     std::sort(std::begin(range), std::end(range), detail::invoke_binary{ std::ref(compare), std::ref(proj) });
 }
 
-template <class Range, class Compare = std::less<>, class Proj = identity_fn>
+template <
+    class Range,
+    class Compare = std::less<>,
+    class Proj = identity_fn,
+    class = execution::detail::disable_if_policy<Range>>
 void stable_sort(Range&& range, Compare compare = {}, Proj proj = {})
 {
     CPP_PIPELINES_CHECK_CONSTRAINTS(range, is_random_access_range);
@@ -1141,7 +1579,12 @@ void stable_sort(Range&& range, Compare compare = {}, Proj proj = {})
     std::stable_sort(std::begin(range), std::end(range), detail::invoke_binary{ std::ref(compare), std::ref(proj) });
 }
 
-template <class Range, class OutputIter, class UnaryFunc, class Proj = identity_fn>
+template <
+    class Range,
+    class OutputIter,
+    class UnaryFunc,
+    class Proj = identity_fn,
+    class = execution::detail::disable_if_policy<Range>>
 auto transform(Range&& range, OutputIter output, UnaryFunc func, Proj proj = {})
 {
     CPP_PIPELINES_CHECK_CONSTRAINTS(range, is_input_range);
@@ -1156,7 +1599,8 @@ template <
     class BinaryFunc,
     class Proj1 = identity_fn,
     class Proj2 = identity_fn,
-    class = std::enable_if_t<is_output_iterator<OutputIter>::value>>
+    class = std::enable_if_t<
+        is_output_iterator<OutputIter>::value && !execution::is_execution_policy<std::decay_t<Range1>>::value>>
 auto transform(Range1&& range1, Range2&& range2, OutputIter output, BinaryFunc func, Proj1 proj1 = {}, Proj2 proj2 = {})
 {
     CPP_PIPELINES_CHECK_CONSTRAINTS(range1, is_input_range);
@@ -1184,11 +1628,27 @@ auto transform_inclusive_scan(Range&& range, Output output, BinaryFunc func, Una
         std::begin(range), std::end(range), output, std::ref(func), fn(std::ref(proj), std::ref(op)));
 }
 
-template <class Range, class T, class BinaryFunc, class UnaryFunc, class Proj = identity_fn>
+template <
+    class Range,
+    class T,
+    class BinaryFunc,
+    class UnaryFunc,
+    class Proj = identity_fn,
+    class = execution::detail::disable_if_policy<Range>>
 auto transform_reduce(Range&& range, T init, BinaryFunc func, UnaryFunc op, Proj proj = {})
 {
-    return std::transform_reduce(
-        std::begin(range), std::end(range), std::move(init), std::ref(func), fn(std::ref(proj), std::ref(op)));
+    if constexpr (
+        detail::is_vectorizable_range<Range, Proj> && std::is_same_v<BinaryFunc, std::plus<>>
+        && simd::is_vectorizable<T>::value && std::is_same_v<std::decay_t<decltype(invoke(op, *std::begin(range)))>, T>)
+    {
+        const auto span = as_span(range);
+        return simd::transform_sum(span.begin(), span.end(), std::move(init), std::ref(op));
+    }
+    else
+    {
+        return std::transform_reduce(
+            std::begin(range), std::end(range), std::move(init), std::ref(func), fn(std::ref(proj), std::ref(op)));
+    }
 }
 
 template <class Policy = default_return_policy, class Range, class BinaryPred = std::equal_to<>, class Proj = identity_fn>
@@ -1232,6 +1692,573 @@ auto overwrite(Range&& range, Dest&& dest, Proj proj = {})
     return detail::overwrite(std::begin(range), std::end(range), std::begin(dest), std::end(dest), std::ref(proj));
 }
 
+// Execution policy overloads. The parallel policies split random access ranges into chunks processed on
+// execution::detail::thread_pool, sequenced ones run the overloads above.
+
+namespace detail
+{
+template <class Iter, class T, class BinaryFunc, class UnaryFunc>
+T parallel_reduce(Iter b, std::size_t size, T init, BinaryFunc func, UnaryFunc op)
+{
+    const execution::detail::chunks chunks{ size };
+    std::vector<std::optional<T>> partials(chunks.count);
+    execution::detail::parallel_invoke(
+        chunks.count,
+        [&](std::size_t c)
+        {
+            const auto first = b + chunks.begin(c);
+            const auto last = b + chunks.end(c);
+            if (first != last)
+            {
+                partials[c] = std::transform_reduce(
+                    std::next(first), last, static_cast<T>(invoke(op, *first)), std::ref(func), std::ref(op));
+            }
+        });
+    for (std::optional<T>& partial : partials)
+    {
+        if (partial)
+        {
+            init = invoke(func, std::move(init), std::move(*partial));
+        }
+    }
+    return init;
+}
+
+// both scans reduce every chunk first, then rescan the chunks starting from the carried totals
+template <class Iter, class Output, class BinaryFunc, class UnaryFunc>
+Output parallel_inclusive_scan(Iter b, std::size_t size, Output output, BinaryFunc func, UnaryFunc op)
+{
+    using T = std::decay_t<decltype(invoke(op, *b))>;
+    const execution::detail::chunks chunks{ size };
+    std::vector<std::optional<T>> carry(chunks.count);
+    execution::detail::parallel_invoke(
+        chunks.count,
+        [&](std::size_t c)
+        {
+            if (c + 1 < chunks.count)
+            {
+                const auto first = b + chunks.begin(c);
+                carry[c + 1] = std::transform_reduce(
+                    std::next(first), b + chunks.end(c), static_cast<T>(invoke(op, *first)), std::ref(func), std::ref(op));
+            }
+        });
+    for (std::size_t c = 2; c < chunks.count; ++c)
+    {
+        carry[c] = invoke(func, *carry[c - 1], std::move(*carry[c]));
+    }
+    execution::detail::parallel_invoke(
+        chunks.count,
+        [&](std::size_t c)
+        {
+            const auto first = b + chunks.begin(c);
+            const auto last = b + chunks.end(c);
+            const auto out = output + chunks.begin(c);
+            if (carry[c])
+            {
+                std::transform_inclusive_scan(first, last, out, std::ref(func), std::ref(op), *carry[c]);
+            }
+            else
+            {
+                std::transform_inclusive_scan(first, last, out, std::ref(func), std::ref(op));
+            }
+        });
+    return output + size;
+}
+
+template <class Iter, class Output, class T, class BinaryFunc, class UnaryFunc>
+Output parallel_exclusive_scan(Iter b, std::size_t size, Output output, T init, BinaryFunc func, UnaryFunc op)
+{
+    const execution::detail::chunks chunks{ size };
+    std::vector<T> carry(chunks.count, init);
+    execution::detail::parallel_invoke(
+        chunks.count,
+        [&](std::size_t c)
+        {
+            if (c + 1 < chunks.count)
+            {
+                const auto first = b + chunks.begin(c);
+                carry[c + 1] = std::transform_reduce(
+                    std::next(first), b + chunks.end(c), static_cast<T>(invoke(op, *first)), std::ref(func), std::ref(op));
+            }
+        });
+    for (std::size_t c = 1; c < chunks.count; ++c)
+    {
+        carry[c] = invoke(func, carry[c - 1], std::move(carry[c]));
+    }
+    execution::detail::parallel_invoke(
+        chunks.count,
+        [&](std::size_t c)
+        {
+            std::transform_exclusive_scan(
+                b + chunks.begin(c), b + chunks.end(c), output + chunks.begin(c), carry[c], std::ref(func), std::ref(op));
+        });
+    return output + size;
+}
+
+// sorts the chunks, then merges neighbouring runs pairwise; inplace_merge is stable, so is the result for a stable Sort
+template <class Iter, class Compare, class Sort>
+void parallel_sort(Iter b, std::size_t size, Compare compare, Sort sort)
+{
+    const execution::detail::chunks chunks{ size };
+    execution::detail::parallel_invoke(
+        chunks.count, [&](std::size_t c) { sort(b + chunks.begin(c), b + chunks.end(c), std::ref(compare)); });
+    for (std::size_t width = 1; width < chunks.count; width *= 2)
+    {
+        execution::detail::parallel_invoke(
+            (chunks.count + 2 * width - 1) / (2 * width),
+            [&](std::size_t pair)
+            {
+                const std::size_t first = pair * 2 * width;
+                const std::size_t middle = std::min(first + width, chunks.count);
+                const std::size_t last = std::min(first + 2 * width, chunks.count);
+                std::inplace_merge(
+                    b + chunks.begin(first), b + chunks.begin(middle), b + chunks.end(last - 1), std::ref(compare));
+            });
+    }
+}
+
+}  // namespace detail
+
+template <
+    class ExecutionPolicy,
+    class Range,
+    class UnaryFunc,
+    class Proj = identity_fn,
+    class = execution::detail::enable_if_policy<ExecutionPolicy>>
+void for_each(ExecutionPolicy&& policy, Range&& range, UnaryFunc func, Proj proj = {})
+{
+    constexpr auto backend = execution::detail::backend_of<ExecutionPolicy>;
+    if constexpr (backend == execution::detail::backend::standard)
+    {
+        std::for_each(
+            std::forward<ExecutionPolicy>(policy), std::begin(range), std::end(range), fn(std::ref(proj), std::ref(func)));
+    }
+    else if constexpr (backend == execution::detail::backend::pool)
+    {
+        CPP_PIPELINES_CHECK_CONSTRAINTS(range, is_random_access_range);
+
+        const auto b = std::begin(range);
+        const execution::detail::chunks chunks{ static_cast<std::size_t>(std::distance(b, std::end(range))) };
+        execution::detail::parallel_invoke(
+            chunks.count,
+            [&](std::size_t c)
+            { std::for_each(b + chunks.begin(c), b + chunks.end(c), fn(std::ref(proj), std::ref(func))); });
+    }
+    else
+    {
+        for_each(std::forward<Range>(range), std::ref(func), std::ref(proj));
+    }
+}
+
+template <
+    class ExecutionPolicy,
+    class Range,
+    class OutputIter,
+    class UnaryFunc,
+    class Proj = identity_fn,
+    class = execution::detail::enable_if_policy<ExecutionPolicy>>
+auto transform(ExecutionPolicy&& policy, Range&& range, OutputIter output, UnaryFunc func, Proj proj = {})
+{
+    constexpr auto backend = execution::detail::backend_of<ExecutionPolicy>;
+    if constexpr (backend == execution::detail::backend::standard)
+    {
+        return std::transform(
+            std::forward<ExecutionPolicy>(policy),
+            std::begin(range),
+            std::end(range),
+            output,
+            fn(std::ref(proj), std::ref(func)));
+    }
+    else if constexpr (backend == execution::detail::backend::pool)
+    {
+        CPP_PIPELINES_CHECK_CONSTRAINTS(range, is_random_access_range);
+        CPP_PIPELINES_CHECK_CONSTRAINTS(output, is_random_access_iterator);
+
+        const auto b = std::begin(range);
+        const auto size = static_cast<std::size_t>(std::distance(b, std::end(range)));
+        const execution::detail::chunks chunks{ size };
+        execution::detail::parallel_invoke(
+            chunks.count,
+            [&](std::size_t c)
+            {
+                std::transform(
+                    b + chunks.begin(c), b + chunks.end(c), output + chunks.begin(c), fn(std::ref(proj), std::ref(func)));
+            });
+        return output + size;
+    }
+    else
+    {
+        return transform(std::forward<Range>(range), output, std::ref(func), std::ref(proj));
+    }
+}
+
+template <
+    class ExecutionPolicy,
+    class Range,
+    class T,
+    class BinaryFunc = std::plus<>,
+    class Proj = identity_fn,
+    class = execution::detail::enable_if_policy<ExecutionPolicy>>
+auto reduce(ExecutionPolicy&& policy, Range&& range, T init, BinaryFunc func = {}, Proj proj = {})
+{
+    constexpr auto backend = execution::detail::backend_of<ExecutionPolicy>;
+    if constexpr (backend == execution::detail::backend::standard)
+    {
+        return std::transform_reduce(
+            std::forward<ExecutionPolicy>(policy),
+            std::begin(range),
+            std::end(range),
+            std::move(init),
+            std::ref(func),
+            std::ref(proj));
+    }
+    else if constexpr (backend == execution::detail::backend::pool)
+    {
+        CPP_PIPELINES_CHECK_CONSTRAINTS(range, is_random_access_range);
+
+        const auto b = std::begin(range);
+        return detail::parallel_reduce(
+            b, static_cast<std::size_t>(std::distance(b, std::end(range))), std::move(init), std::ref(func), std::ref(proj));
+    }
+    else
+    {
+        return reduce(std::forward<Range>(range), std::move(init), std::ref(func), std::ref(proj));
+    }
+}
+
+template <
+    class ExecutionPolicy,
+    class Range,
+    class T,
+    class BinaryFunc,
+    class UnaryFunc,
+    class Proj = identity_fn,
+    class = execution::detail::enable_if_policy<ExecutionPolicy>>
+auto transform_reduce(ExecutionPolicy&& policy, Range&& range, T init, BinaryFunc func, UnaryFunc op, Proj proj = {})
+{
+    return reduce(
+        std::forward<ExecutionPolicy>(policy),
+        std::forward<Range>(range),
+        std::move(init),
+        std::ref(func),
+        fn(std::ref(proj), std::ref(op)));
+}
+
+template <
+    class ExecutionPolicy,
+    class Range,
+    class UnaryPred,
+    class Proj = identity_fn,
+    class = execution::detail::enable_if_policy<ExecutionPolicy>>
+auto count_if(ExecutionPolicy&& policy, Range&& range, UnaryPred pred, Proj proj = {})
+{
+    using difference_type = iter_difference_t<iterator_t<Range>>;
+    return reduce(
+        std::forward<ExecutionPolicy>(policy),
+        std::forward<Range>(range),
+        difference_type{ 0 },
+        std::plus<>{},
+        [&](auto&& item) -> difference_type
+        { return invoke(pred, invoke(proj, std::forward<decltype(item)>(item))) ? 1 : 0; });
+}
+
+template <
+    class Policy = default_return_policy,
+    class ExecutionPolicy,
+    class Range,
+    class UnaryPred,
+    class Proj = identity_fn,
+    class = execution::detail::enable_if_policy<ExecutionPolicy>>
+decltype(auto) find_if(ExecutionPolicy&& policy, Range&& range, UnaryPred pred, Proj proj = {})
+{
+    constexpr auto backend = execution::detail::backend_of<ExecutionPolicy>;
+    if constexpr (backend == execution::detail::backend::standard)
+    {
+        return detail::invoke_algorithm<Policy>(
+            std::begin(range),
+            std::end(range),
+            [&](auto b, auto e)
+            { return std::find_if(std::forward<ExecutionPolicy>(policy), b, e, fn(std::ref(proj), std::ref(pred))); });
+    }
+    else if constexpr (backend == execution::detail::backend::pool)
+    {
+        CPP_PIPELINES_CHECK_CONSTRAINTS(range, is_random_access_range);
+
+        return detail::invoke_algorithm<Policy>(
+            std::begin(range),
+            std::end(range),
+            [&](auto b, auto e)
+            {
+                // the chunks stop as soon as an earlier match has been found
+                const auto size = static_cast<std::size_t>(std::distance(b, e));
+                const execution::detail::chunks chunks{ size };
+                std::atomic<std::size_t> found{ size };
+                execution::detail::parallel_invoke(
+                    chunks.count,
+                    [&](std::size_t c)
+                    {
+                        for (std::size_t i = chunks.begin(c); i < chunks.end(c) && i < found.load(); ++i)
+                        {
+                            if (invoke(pred, invoke(proj, b[i])))
+                            {
+                                std::size_t current = found.load();
+                                while (i < current && !found.compare_exchange_weak(current, i))
+                                {
+                                }
+                                return;
+                            }
+                        }
+                    });
+                return b + found.load();
+            });
+    }
+    else
+    {
+        return find_if<Policy>(std::forward<Range>(range), std::ref(pred), std::ref(proj));
+    }
+}
+
+template <
+    class ExecutionPolicy,
+    class Range,
+    class UnaryPred,
+    class Proj = identity_fn,
+    class = execution::detail::enable_if_policy<ExecutionPolicy>>
+auto any_of(ExecutionPolicy&& policy, Range&& range, UnaryPred pred, Proj proj = {})
+{
+    return find_if<return_opt_found>(
+        std::forward<ExecutionPolicy>(policy), range, std::ref(pred), std::ref(proj)).has_value();
+}
+
+template <
+    class ExecutionPolicy,
+    class Range,
+    class UnaryPred,
+    class Proj = identity_fn,
+    class = execution::detail::enable_if_policy<ExecutionPolicy>>
+auto all_of(ExecutionPolicy&& policy, Range&& range, UnaryPred pred, Proj proj = {})
+{
+    return !any_of(std::forward<ExecutionPolicy>(policy), range, std::not_fn(fn(std::ref(proj), std::ref(pred))));
+}
+
+template <
+    class ExecutionPolicy,
+    class Range,
+    class UnaryPred,
+    class Proj = identity_fn,
+    class = execution::detail::enable_if_policy<ExecutionPolicy>>
+auto none_of(ExecutionPolicy&& policy, Range&& range, UnaryPred pred, Proj proj = {})
+{
+    return !any_of(std::forward<ExecutionPolicy>(policy), range, std::ref(pred), std::ref(proj));
+}
+
+template <
+    class ExecutionPolicy,
+    class Range,
+    class OutputIter,
+    class UnaryPred,
+    class Proj = identity_fn,
+    class = execution::detail::enable_if_policy<ExecutionPolicy>>
+auto copy_if(ExecutionPolicy&& policy, Range&& range, OutputIter output, UnaryPred pred, Proj proj = {})
+{
+    constexpr auto backend = execution::detail::backend_of<ExecutionPolicy>;
+    if constexpr (backend == execution::detail::backend::standard)
+    {
+        return std::copy_if(
+            std::forward<ExecutionPolicy>(policy),
+            std::begin(range),
+            std::end(range),
+            output,
+            fn(std::ref(proj), std::ref(pred)));
+    }
+    else if constexpr (backend == execution::detail::backend::pool)
+    {
+        CPP_PIPELINES_CHECK_CONSTRAINTS(range, is_random_access_range);
+        CPP_PIPELINES_CHECK_CONSTRAINTS(output, is_random_access_iterator);
+
+        // the predicate is evaluated once; the matches counted per chunk give every chunk its output offset
+        const auto b = std::begin(range);
+        const auto size = static_cast<std::size_t>(std::distance(b, std::end(range)));
+        const execution::detail::chunks chunks{ size };
+        std::vector<char> selected(size);
+        std::vector<std::size_t> offsets(chunks.count + 1);
+        execution::detail::parallel_invoke(
+            chunks.count,
+            [&](std::size_t c)
+            {
+                for (std::size_t i = chunks.begin(c); i < chunks.end(c); ++i)
+                {
+                    selected[i] = static_cast<bool>(invoke(pred, invoke(proj, b[i])));
+                    offsets[c + 1] += selected[i];
+                }
+            });
+        std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+        execution::detail::parallel_invoke(
+            chunks.count,
+            [&](std::size_t c)
+            {
+                auto out = output + offsets[c];
+                for (std::size_t i = chunks.begin(c); i < chunks.end(c); ++i)
+                {
+                    if (selected[i])
+                    {
+                        *out++ = b[i];
+                    }
+                }
+            });
+        return output + offsets.back();
+    }
+    else
+    {
+        return copy_if(std::forward<Range>(range), output, std::ref(pred), std::ref(proj));
+    }
+}
+
+template <
+    class ExecutionPolicy,
+    class Range,
+    class Output,
+    class BinaryFunc,
+    class Proj = identity_fn,
+    class = execution::detail::enable_if_policy<ExecutionPolicy>>
+auto inclusive_scan(ExecutionPolicy&& policy, Range&& range, Output output, BinaryFunc func, Proj proj = {})
+{
+    constexpr auto backend = execution::detail::backend_of<ExecutionPolicy>;
+    if constexpr (backend == execution::detail::backend::standard)
+    {
+        return std::transform_inclusive_scan(
+            std::forward<ExecutionPolicy>(policy),
+            std::begin(range),
+            std::end(range),
+            output,
+            std::ref(func),
+            std::ref(proj));
+    }
+    else if constexpr (backend == execution::detail::backend::pool)
+    {
+        CPP_PIPELINES_CHECK_CONSTRAINTS(range, is_random_access_range);
+        CPP_PIPELINES_CHECK_CONSTRAINTS(output, is_random_access_iterator);
+
+        const auto b = std::begin(range);
+        return detail::parallel_inclusive_scan(
+            b, static_cast<std::size_t>(std::distance(b, std::end(range))), output, std::ref(func), std::ref(proj));
+    }
+    else
+    {
+        return inclusive_scan(std::forward<Range>(range), output, std::ref(func), std::ref(proj));
+    }
+}
+
+template <
+    class ExecutionPolicy,
+    class Range,
+    class Output,
+    class T,
+    class BinaryFunc,
+    class Proj = identity_fn,
+    class = execution::detail::enable_if_policy<ExecutionPolicy>>
+auto exclusive_scan(ExecutionPolicy&& policy, Range&& range, Output output, T init, BinaryFunc func, Proj proj = {})
+{
+    constexpr auto backend = execution::detail::backend_of<ExecutionPolicy>;
+    if constexpr (backend == execution::detail::backend::standard)
+    {
+        return std::transform_exclusive_scan(
+            std::forward<ExecutionPolicy>(policy),
+            std::begin(range),
+            std::end(range),
+            output,
+            std::move(init),
+            std::ref(func),
+            std::ref(proj));
+    }
+    else if constexpr (backend == execution::detail::backend::pool)
+    {
+        CPP_PIPELINES_CHECK_CONSTRAINTS(range, is_random_access_range);
+        CPP_PIPELINES_CHECK_CONSTRAINTS(output, is_random_access_iterator);
+
+        const auto b = std::begin(range);
+        return detail::parallel_exclusive_scan(
+            b,
+            static_cast<std::size_t>(std::distance(b, std::end(range))),
+            output,
+            std::move(init),
+            std::ref(func),
+            std::ref(proj));
+    }
+    else
+    {
+        return exclusive_scan(std::forward<Range>(range), output, std::move(init), std::ref(func), std::ref(proj));
+    }
+}
+
+template <
+    class ExecutionPolicy,
+    class Range,
+    class Compare = std::less<>,
+    class Proj = identity_fn,
+    class = execution::detail::enable_if_policy<ExecutionPolicy>>
+void sort(ExecutionPolicy&& policy, Range&& range, Compare compare = {}, Proj proj = {})
+{
+    CPP_PIPELINES_CHECK_CONSTRAINTS(range, is_random_access_range);
+
+    constexpr auto backend = execution::detail::backend_of<ExecutionPolicy>;
+    if constexpr (backend == execution::detail::backend::standard)
+    {
+        std::sort(
+            std::forward<ExecutionPolicy>(policy),
+            std::begin(range),
+            std::end(range),
+            detail::invoke_binary{ std::ref(compare), std::ref(proj) });
+    }
+    else if constexpr (backend == execution::detail::backend::pool)
+    {
+        const auto b = std::begin(range);
+        detail::parallel_sort(
+            b,
+            static_cast<std::size_t>(std::distance(b, std::end(range))),
+            detail::invoke_binary{ std::ref(compare), std::ref(proj) },
+            [](auto first, auto last, auto cmp) { std::sort(first, last, cmp); });
+    }
+    else
+    {
+        sort(std::forward<Range>(range), std::ref(compare), std::ref(proj));
+    }
+}
+
+template <
+    class ExecutionPolicy,
+    class Range,
+    class Compare = std::less<>,
+    class Proj = identity_fn,
+    class = execution::detail::enable_if_policy<ExecutionPolicy>>
+void stable_sort(ExecutionPolicy&& policy, Range&& range, Compare compare = {}, Proj proj = {})
+{
+    CPP_PIPELINES_CHECK_CONSTRAINTS(range, is_random_access_range);
+
+    constexpr auto backend = execution::detail::backend_of<ExecutionPolicy>;
+    if constexpr (backend == execution::detail::backend::standard)
+    {
+        std::stable_sort(
+            std::forward<ExecutionPolicy>(policy),
+            std::begin(range),
+            std::end(range),
+            detail::invoke_binary{ std::ref(compare), std::ref(proj) });
+    }
+    else if constexpr (backend == execution::detail::backend::pool)
+    {
+        const auto b = std::begin(range);
+        detail::parallel_sort(
+            b,
+            static_cast<std::size_t>(std::distance(b, std::end(range))),
+            detail::invoke_binary{ std::ref(compare), std::ref(proj) },
+            [](auto first, auto last, auto cmp) { std::stable_sort(first, last, cmp); });
+    }
+    else
+    {
+        stable_sort(std::forward<Range>(range), std::ref(compare), std::ref(proj));
+    }
+}
+
 #undef CPP_PIPELINES_CHECK_CONSTRAINTS
 
 }  // namespace cpp_pipelines::algorithm
@@ -0,0 +1,290 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+// Define CPP_PIPELINES_STD_EXECUTION to accept the std::execution policies as well. They are forwarded to the standard
+// library when it has a parallel backend (libstdc++ only has one with TBB), otherwise they run on the internal pool.
+#if defined(CPP_PIPELINES_STD_EXECUTION)
+#include <execution>
+#endif
+
+namespace cpp_pipelines::execution
+{
+struct sequenced_policy
+{
+};
+
+struct parallel_policy
+{
+};
+
+struct parallel_unsequenced_policy
+{
+};
+
+static constexpr inline auto seq = sequenced_policy{};
+static constexpr inline auto par = parallel_policy{};
+static constexpr inline auto par_unseq = parallel_unsequenced_policy{};
+
+template <class T>
+struct is_execution_policy : std::false_type
+{
+};
+
+template <>
+struct is_execution_policy<sequenced_policy> : std::true_type
+{
+};
+
+template <>
+struct is_execution_policy<parallel_policy> : std::true_type
+{
+};
+
+template <>
+struct is_execution_policy<parallel_unsequenced_policy> : std::true_type
+{
+};
+
+template <class T>
+struct is_parallel_policy
+    : std::bool_constant<std::is_same_v<T, parallel_policy> || std::is_same_v<T, parallel_unsequenced_policy>>
+{
+};
+
+#if defined(CPP_PIPELINES_STD_EXECUTION)
+
+template <class T>
+struct is_std_execution_policy : std::is_execution_policy<T>
+{
+};
+
+template <>
+struct is_execution_policy<std::execution::sequenced_policy> : std::true_type
+{
+};
+
+template <>
+struct is_execution_policy<std::execution::parallel_policy> : std::true_type
+{
+};
+
+template <>
+struct is_execution_policy<std::execution::parallel_unsequenced_policy> : std::true_type
+{
+};
+
+template <>
+struct is_parallel_policy<std::execution::parallel_policy> : std::true_type
+{
+};
+
+template <>
+struct is_parallel_policy<std::execution::parallel_unsequenced_policy> : std::true_type
+{
+};
+
+#else
+
+template <class T>
+struct is_std_execution_policy : std::false_type
+{
+};
+
+#endif
+
+#if defined(CPP_PIPELINES_STD_EXECUTION) && (!defined(__GLIBCXX__) || defined(_PSTL_PAR_BACKEND_TBB))
+static constexpr inline bool has_std_backend = true;
+#else
+static constexpr inline bool has_std_backend = false;
+#endif
+
+namespace detail
+{
+template <class T>
+using enable_if_policy = std::enable_if_t<is_execution_policy<std::decay_t<T>>::value>;
+
+template <class T>
+using disable_if_policy = std::enable_if_t<!is_execution_policy<std::decay_t<T>>::value>;
+
+// std policies go to the standard library, parallel ones to the internal pool, the rest runs serially
+enum class backend
+{
+    serial,
+    pool,
+    standard
+};
+
+template <class ExecutionPolicy, class P = std::decay_t<ExecutionPolicy>>
+static constexpr inline backend backend_of = is_std_execution_policy<P>::value && has_std_backend
+                                                 ? backend::standard
+                                                 : is_parallel_policy<P>::value ? backend::pool : backend::serial;
+
+class thread_pool
+{
+public:
+    explicit thread_pool(std::size_t size)
+    {
+        for (std::size_t i = 0; i < size; ++i)
+        {
+            _workers.emplace_back([this]() { work(); });
+        }
+    }
+
+    thread_pool(const thread_pool&) = delete;
+    thread_pool& operator=(const thread_pool&) = delete;
+
+    ~thread_pool()
+    {
+        {
+            std::lock_guard lock{ _mutex };
+            _stopped = true;
+        }
+        _condition.notify_all();
+        for (std::thread& worker : _workers)
+        {
+            worker.join();
+        }
+    }
+
+    std::size_t size() const
+    {
+        return _workers.size();
+    }
+
+    void submit(std::function<void()> task)
+    {
+        {
+            std::lock_guard lock{ _mutex };
+            _tasks.push_back(std::move(task));
+        }
+        _condition.notify_one();
+    }
+
+    static thread_pool& instance()
+    {
+        static thread_pool pool{ std::max(std::thread::hardware_concurrency(), 2u) - 1 };
+        return pool;
+    }
+
+private:
+    void work()
+    {
+        while (true)
+        {
+            std::function<void()> task;
+            {
+                std::unique_lock lock{ _mutex };
+                _condition.wait(lock, [this]() { return _stopped || !_tasks.empty(); });
+                if (_tasks.empty())
+                {
+                    return;
+                }
+                task = std::move(_tasks.front());
+                _tasks.pop_front();
+            }
+            task();
+        }
+    }
+
+    std::vector<std::thread> _workers;
+    std::deque<std::function<void()>> _tasks;
+    std::mutex _mutex;
+    std::condition_variable _condition;
+    bool _stopped = false;
+};
+
+// Calls func(i) for every i in [0, count) on the pool. The calling thread takes part in the work, so nested calls
+// cannot starve; the first exception thrown is rethrown once all the calls have finished.
+template <class Func>
+void parallel_invoke(std::size_t count, Func&& func)
+{
+    struct state
+    {
+        std::atomic<std::size_t> next{ 0 };
+        std::size_t count;
+        std::size_t done = 0;
+        std::exception_ptr error;
+        std::mutex mutex;
+        std::condition_variable condition;
+    };
+
+    const auto shared = std::make_shared<state>();
+    shared->count = count;
+
+    const auto work = [shared, &func]()
+    {
+        for (std::size_t i = shared->next++; i < shared->count; i = shared->next++)
+        {
+            std::exception_ptr error;
+            try
+            {
+                func(i);
+            }
+            catch (...)
+            {
+                error = std::current_exception();
+            }
+            std::lock_guard lock{ shared->mutex };
+            if (error && !shared->error)
+            {
+                shared->error = error;
+            }
+            if (++shared->done == shared->count)
+            {
+                shared->condition.notify_all();
+            }
+        }
+    };
+
+    thread_pool& pool = thread_pool::instance();
+    for (std::size_t i = 1; i < std::min(count, pool.size() + 1); ++i)
+    {
+        pool.submit(work);
+    }
+    work();
+
+    std::unique_lock lock{ shared->mutex };
+    shared->condition.wait(lock, [&]() { return shared->done == shared->count; });
+    if (shared->error)
+    {
+        std::rethrow_exception(shared->error);
+    }
+}
+
+// consecutive, non-empty slices of [0, size), a few per thread so that uneven work balances out
+struct chunks
+{
+    std::size_t size;
+    std::size_t count;
+
+    explicit chunks(std::size_t size, std::size_t grain = 1024)
+        : size{ size }
+        , count{ std::min(std::max<std::size_t>(size / grain, 1), 4 * (thread_pool::instance().size() + 1)) }
+    {
+    }
+
+    std::size_t begin(std::size_t index) const
+    {
+        return size * index / count;
+    }
+
+    std::size_t end(std::size_t index) const
+    {
+        return size * (index + 1) / count;
+    }
+};
+
+}  // namespace detail
+
+}  // namespace cpp_pipelines::execution
@@ -0,0 +1,329 @@
+#pragma once
+
+#include <cpp_pipelines/flat_set.hpp>
+#include <cpp_pipelines/iterator_interface.hpp>
+#include <stdexcept>
+
+namespace cpp_pipelines
+{
+namespace detail
+{
+// Yields std::pair<const K&, V&>: assigning a key through an iterator would break the order of the map.
+template <class Iter, class K, class V>
+struct flat_map_iter
+{
+    using value_type = std::pair<K, std::remove_const_t<V>>;
+
+    Iter it;
+
+    flat_map_iter() = default;
+
+    explicit flat_map_iter(Iter it)
+        : it{ it }
+    {
+    }
+
+    // iterator to const_iterator
+    template <
+        class Other,
+        class = std::enable_if_t<!std::is_same_v<Other, Iter> && std::is_convertible_v<Other, Iter>>>
+    flat_map_iter(const iterator_interface<flat_map_iter<Other, K, std::remove_const_t<V>>>& other)
+        : it{ other.impl.it }
+    {
+    }
+
+    std::pair<const K&, V&> deref() const
+    {
+        return { it->first, it->second };
+    }
+
+    void inc()
+    {
+        ++it;
+    }
+
+    void dec()
+    {
+        --it;
+    }
+
+    void advance(std::ptrdiff_t n)
+    {
+        it += n;
+    }
+
+    std::ptrdiff_t distance_to(const flat_map_iter& other) const
+    {
+        return other.it - it;
+    }
+
+    bool is_equal(const flat_map_iter& other) const
+    {
+        return it == other.it;
+    }
+};
+
+}  // namespace detail
+
+template <class K, class V, class Compare = std::less<K>, class Container = std::vector<std::pair<K, V>>>
+class flat_map
+{
+public:
+    using key_type = K;
+    using mapped_type = V;
+    using value_type = std::pair<K, V>;
+    using key_compare = Compare;
+    using container_type = Container;
+    using size_type = typename Container::size_type;
+    using difference_type = typename Container::difference_type;
+    using reference = std::pair<const K&, V&>;
+    using const_reference = std::pair<const K&, const V&>;
+    using iterator = iterator_interface<detail::flat_map_iter<typename Container::iterator, K, V>>;
+    using const_iterator = iterator_interface<detail::flat_map_iter<typename Container::const_iterator, K, const V>>;
+
+    flat_map() = default;
+
+    explicit flat_map(const Compare& compare)
+        : _data{}
+        , _compare{ compare }
+    {
+    }
+
+    flat_map(sorted_unique_t, Container data, const Compare& compare = {})
+        : _data{ std::move(data) }
+        , _compare{ compare }
+    {
+    }
+
+    explicit flat_map(Container data, const Compare& compare = {})
+        : _data{ std::move(data) }
+        , _compare{ compare }
+    {
+        detail::sort_unique(_data, _compare, get_key);
+    }
+
+    template <class Iter, class = std::enable_if_t<is_input_iterator<Iter>::value>>
+    flat_map(Iter b, Iter e, const Compare& compare = {})
+        : flat_map(Container(b, e), compare)
+    {
+    }
+
+    flat_map(std::initializer_list<value_type> init, const Compare& compare = {})
+        : flat_map(init.begin(), init.end(), compare)
+    {
+    }
+
+    iterator begin()
+    {
+        return iterator{ _data.begin() };
+    }
+
+    iterator end()
+    {
+        return iterator{ _data.end() };
+    }
+
+    const_iterator begin() const
+    {
+        return const_iterator{ _data.begin() };
+    }
+
+    const_iterator end() const
+    {
+        return const_iterator{ _data.end() };
+    }
+
+    size_type size() const
+    {
+        return _data.size();
+    }
+
+    bool empty() const
+    {
+        return _data.empty();
+    }
+
+    void clear()
+    {
+        _data.clear();
+    }
+
+    void reserve(size_type n)
+    {
+        _data.reserve(n);
+    }
+
+    const key_compare& key_comp() const
+    {
+        return _compare;
+    }
+
+    const Container& container() const
+    {
+        return _data;
+    }
+
+    Container extract() &&
+    {
+        return std::move(_data);
+    }
+
+    iterator lower_bound(const key_type& key)
+    {
+        return iterator{ algorithm::lower_bound(_data, key, std::ref(_compare), get_key) };
+    }
+
+    const_iterator lower_bound(const key_type& key) const
+    {
+        return const_iterator{ algorithm::lower_bound(_data, key, std::ref(_compare), get_key) };
+    }
+
+    iterator upper_bound(const key_type& key)
+    {
+        return iterator{ algorithm::upper_bound(_data, key, std::ref(_compare), get_key) };
+    }
+
+    const_iterator upper_bound(const key_type& key) const
+    {
+        return const_iterator{ algorithm::upper_bound(_data, key, std::ref(_compare), get_key) };
+    }
+
+    std::pair<iterator, iterator> equal_range(const key_type& key)
+    {
+        const auto it = lower_bound(key);
+        return { it, matches(it, key) ? std::next(it) : it };
+    }
+
+    std::pair<const_iterator, const_iterator> equal_range(const key_type& key) const
+    {
+        const auto it = lower_bound(key);
+        return { it, matches(it, key) ? std::next(it) : it };
+    }
+
+    iterator find(const key_type& key)
+    {
+        const auto it = lower_bound(key);
+        return matches(it, key) ? it : end();
+    }
+
+    const_iterator find(const key_type& key) const
+    {
+        const auto it = lower_bound(key);
+        return matches(it, key) ? it : end();
+    }
+
+    bool contains(const key_type& key) const
+    {
+        return find(key) != end();
+    }
+
+    size_type count(const key_type& key) const
+    {
+        return contains(key) ? 1 : 0;
+    }
+
+    mapped_type& at(const key_type& key)
+    {
+        const auto it = find(key);
+        if (it == end())
+        {
+            throw std::out_of_range{ "flat_map::at: key not found" };
+        }
+        return it->second;
+    }
+
+    const mapped_type& at(const key_type& key) const
+    {
+        const auto it = find(key);
+        if (it == end())
+        {
+            throw std::out_of_range{ "flat_map::at: key not found" };
+        }
+        return it->second;
+    }
+
+    mapped_type& operator[](const key_type& key)
+    {
+        return try_emplace(key).first->second;
+    }
+
+    template <class... Args>
+    std::pair<iterator, bool> try_emplace(const key_type& key, Args&&... args)
+    {
+        const auto it = lower_bound(key);
+        if (matches(it, key))
+        {
+            return { it, false };
+        }
+        const auto inserted = _data.emplace(
+            it.impl.it,
+            std::piecewise_construct,
+            std::forward_as_tuple(key),
+            std::forward_as_tuple(std::forward<Args>(args)...));
+        return { iterator{ inserted }, true };
+    }
+
+    std::pair<iterator, bool> insert(value_type value)
+    {
+        const auto it = lower_bound(value.first);
+        if (matches(it, value.first))
+        {
+            return { it, false };
+        }
+        return { iterator{ _data.insert(it.impl.it, std::move(value)) }, true };
+    }
+
+    iterator insert(const_iterator hint, value_type value)
+    {
+        // a correct hint (e.g. end() when appending in order, as std::inserter does) costs O(1)
+        if ((hint == end() || _compare(value.first, hint->first))
+            && (hint == begin() || _compare(std::prev(hint)->first, value.first)))
+        {
+            return iterator{ _data.insert(hint.impl.it, std::move(value)) };
+        }
+        return insert(std::move(value)).first;
+    }
+
+    iterator erase(const_iterator it)
+    {
+        return iterator{ _data.erase(it.impl.it) };
+    }
+
+    size_type erase(const key_type& key)
+    {
+        const auto it = find(key);
+        if (it == end())
+        {
+            return 0;
+        }
+        erase(it);
+        return 1;
+    }
+
+    friend bool operator==(const flat_map& lhs, const flat_map& rhs)
+    {
+        return lhs._data == rhs._data;
+    }
+
+    friend bool operator!=(const flat_map& lhs, const flat_map& rhs)
+    {
+        return !(lhs == rhs);
+    }
+
+    friend bool operator<(const flat_map& lhs, const flat_map& rhs)
+    {
+        return lhs._data < rhs._data;
+    }
+
+private:
+    template <class Iter>
+    bool matches(Iter it, const key_type& key) const
+    {
+        return it.impl.it != _data.end() && !_compare(key, it->first);
+    }
+
+    Container _data;
+    Compare _compare;
+};
+
+}  // namespace cpp_pipelines
@@ -0,0 +1,223 @@
+#pragma once
+
+#include <cpp_pipelines/algorithm.hpp>
+#include <initializer_list>
+#include <vector>
+
+namespace cpp_pipelines
+{
+struct sorted_unique_t
+{
+    explicit sorted_unique_t() = default;
+};
+
+static constexpr inline auto sorted_unique = sorted_unique_t{};
+
+namespace detail
+{
+template <class Container, class Compare, class KeyOf>
+void sort_unique(Container& data, const Compare& compare, const KeyOf& key_of)
+{
+    // already sorted input (e.g. the output of a set operation) is adopted in linear time
+    if (!algorithm::is_sorted(data, std::ref(compare), std::ref(key_of)))
+    {
+        algorithm::stable_sort(data, std::ref(compare), std::ref(key_of));
+    }
+    const auto equivalent = [&](const auto& lhs, const auto& rhs) { return !invoke(compare, lhs, rhs); };
+    data.erase(algorithm::unique(data, equivalent, std::ref(key_of)), std::end(data));
+}
+
+}  // namespace detail
+
+template <class T, class Compare = std::less<T>, class Container = std::vector<T>>
+class flat_set
+{
+public:
+    using key_type = T;
+    using value_type = T;
+    using key_compare = Compare;
+    using value_compare = Compare;
+    using container_type = Container;
+    using size_type = typename Container::size_type;
+    using difference_type = typename Container::difference_type;
+    using reference = const T&;
+    using const_reference = const T&;
+    using iterator = typename Container::const_iterator;
+    using const_iterator = typename Container::const_iterator;
+
+    flat_set() = default;
+
+    explicit flat_set(const Compare& compare)
+        : _data{}
+        , _compare{ compare }
+    {
+    }
+
+    flat_set(sorted_unique_t, Container data, const Compare& compare = {})
+        : _data{ std::move(data) }
+        , _compare{ compare }
+    {
+    }
+
+    explicit flat_set(Container data, const Compare& compare = {})
+        : _data{ std::move(data) }
+        , _compare{ compare }
+    {
+        detail::sort_unique(_data, _compare, identity);
+    }
+
+    template <class Iter, class = std::enable_if_t<is_input_iterator<Iter>::value>>
+    flat_set(Iter b, Iter e, const Compare& compare = {})
+        : flat_set(Container(b, e), compare)
+    {
+    }
+
+    flat_set(std::initializer_list<T> init, const Compare& compare = {})
+        : flat_set(init.begin(), init.end(), compare)
+    {
+    }
+
+    const_iterator begin() const
+    {
+        return _data.begin();
+    }
+
+    const_iterator end() const
+    {
+        return _data.end();
+    }
+
+    size_type size() const
+    {
+        return _data.size();
+    }
+
+    bool empty() const
+    {
+        return _data.empty();
+    }
+
+    void clear()
+    {
+        _data.clear();
+    }
+
+    void reserve(size_type n)
+    {
+        _data.reserve(n);
+    }
+
+    const key_compare& key_comp() const
+    {
+        return _compare;
+    }
+
+    const value_compare& value_comp() const
+    {
+        return _compare;
+    }
+
+    const Container& container() const
+    {
+        return _data;
+    }
+
+    const value_type* data() const
+    {
+        return _data.data();
+    }
+
+    Container extract() &&
+    {
+        return std::move(_data);
+    }
+
+    const_iterator lower_bound(const key_type& key) const
+    {
+        return algorithm::lower_bound(_data, key, std::ref(_compare));
+    }
+
+    const_iterator upper_bound(const key_type& key) const
+    {
+        return algorithm::upper_bound(_data, key, std::ref(_compare));
+    }
+
+    std::pair<const_iterator, const_iterator> equal_range(const key_type& key) const
+    {
+        const auto it = lower_bound(key);
+        return { it, it != end() && !_compare(key, *it) ? std::next(it) : it };
+    }
+
+    const_iterator find(const key_type& key) const
+    {
+        const auto it = lower_bound(key);
+        return it != end() && !_compare(key, *it) ? it : end();
+    }
+
+    bool contains(const key_type& key) const
+    {
+        return find(key) != end();
+    }
+
+    size_type count(const key_type& key) const
+    {
+        return contains(key) ? 1 : 0;
+    }
+
+    std::pair<iterator, bool> insert(value_type value)
+    {
+        const auto it = lower_bound(value);
+        if (it != end() && !_compare(value, *it))
+        {
+            return { it, false };
+        }
+        return { _data.insert(it, std::move(value)), true };
+    }
+
+    iterator insert(const_iterator hint, value_type value)
+    {
+        // a correct hint (e.g. end() when appending in order, as std::inserter does) costs O(1)
+        if ((hint == end() || _compare(value, *hint)) && (hint == begin() || _compare(*std::prev(hint), value)))
+        {
+            return _data.insert(hint, std::move(value));
+        }
+        return insert(std::move(value)).first;
+    }
+
+    iterator erase(const_iterator it)
+    {
+        return _data.erase(it);
+    }
+
+    size_type erase(const key_type& key)
+    {
+        const auto it = find(key);
+        if (it == end())
+        {
+            return 0;
+        }
+        erase(it);
+        return 1;
+    }
+
+    friend bool operator==(const flat_set& lhs, const flat_set& rhs)
+    {
+        return lhs._data == rhs._data;
+    }
+
+    friend bool operator!=(const flat_set& lhs, const flat_set& rhs)
+    {
+        return !(lhs == rhs);
+    }
+
+    friend bool operator<(const flat_set& lhs, const flat_set& rhs)
+    {
+        return lhs._data < rhs._data;
+    }
+
+private:
+    Container _data;
+    Compare _compare;
+};
+
+}  // namespace cpp_pipelines
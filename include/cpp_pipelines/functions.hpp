@@ -1,6 +1,7 @@
 #pragma once
 
 #include <cpp_pipelines/invoke.hpp>
+#include <memory>
 #include <utility>
 
 namespace cpp_pipelines
@@ -210,6 +211,41 @@ struct bind_fn
     }
 };
 
+// Refers to a function object that outlives the pipelines it is used in, so the stages do not copy it.
+struct fn_ref_fn
+{
+    template <class Func>
+    constexpr auto operator()(const Func& func) const -> std::reference_wrapper<const Func>
+    {
+        return std::cref(func);
+    }
+
+    template <class Func>
+    void operator()(const Func&& func) const = delete;
+};
+
+// Shares one function object between the copies of the stages, e.g. of a pipeline applied to many ranges.
+template <class Func>
+struct shared_fn
+{
+    std::shared_ptr<const Func> func;
+
+    template <class... Args>
+    constexpr decltype(auto) operator()(Args&&... args) const
+    {
+        return invoke(*func, std::forward<Args>(args)...);
+    }
+};
+
+struct fn_shared_fn
+{
+    template <class Func>
+    auto operator()(Func func) const -> shared_fn<Func>
+    {
+        return { std::make_shared<const Func>(std::move(func)) };
+    }
+};
+
 struct proj_fn
 {
     template <class Proj, class Func>
@@ -279,4 +315,7 @@ static constexpr inline auto bind_back = detail::bind_fn<false>{};
 
 static constexpr inline auto proj = detail::proj_fn{};
 
+static constexpr inline auto fn_ref = detail::fn_ref_fn{};
+static constexpr inline auto fn_shared = detail::fn_shared_fn{};
+
 }  // namespace cpp_pipelines
\ No newline at end of file
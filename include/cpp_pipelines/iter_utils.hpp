@@ -1,5 +1,6 @@
 #pragma once
 
+#include <algorithm>
 #include <cpp_pipelines/invoke.hpp>
 #include <cpp_pipelines/pipeline.hpp>
 #include <cpp_pipelines/type_traits.hpp>
@@ -34,6 +35,28 @@ constexpr Iter advance_while(Iter it, Pred pred, Iter sentinel)
     return it;
 }
 
+template <class Iter, class Pred>
+constexpr Iter gallop_while(Iter it, Pred pred, Iter sentinel)
+{
+    // 'pred' must hold for a prefix of [it, sentinel) - random access iterators double the step
+    // until the predicate fails and then bisect the last step, other iterators are advanced linearly
+    if constexpr (is_random_access_iterator<Iter>::value)
+    {
+        iter_difference_t<Iter> step = 1;
+        while (step <= sentinel - it && invoke(pred, it[step - 1]))
+        {
+            it += step;
+            step *= 2;
+        }
+        const auto last = step <= sentinel - it ? it + step : sentinel;
+        return std::partition_point(it, last, [&](const auto& item) { return invoke(pred, item); });
+    }
+    else
+    {
+        return advance_while(it, pred, sentinel);
+    }
+}
+
 namespace detail
 {
 struct iter_find_fn
@@ -73,11 +73,8 @@ struct iterator_interface
     {
     }
 
-    constexpr iterator_interface& operator=(iterator_interface other)
-    {
-        std::swap(impl, other.impl);
-        return *this;
-    }
+    constexpr iterator_interface& operator=(const iterator_interface&) = default;
+    constexpr iterator_interface& operator=(iterator_interface&&) = default;
 
     constexpr decltype(auto) operator*() const
     {
@@ -248,13 +245,33 @@ struct difference_type_impl<T, std::void_t<std::enable_if_t<has_distance_to_v<T>
     using type = decltype(std::declval<T>().distance_to(std::declval<T>()));
 };
 
+// adaptors name the iterator they wrap 'inner_iterator'; an adaptor over an input iterator is single pass as well
+template <class T, class = std::void_t<>>
+struct is_single_pass_adaptor : std::false_type
+{
+};
+
+template <class T>
+struct is_single_pass_adaptor<T, std::void_t<typename T::inner_iterator>>
+    : std::negation<std::is_base_of<
+          std::forward_iterator_tag,
+          typename std::iterator_traits<typename T::inner_iterator>::iterator_category>>
+{
+};
+
 template <class T, class = std::void_t<>>
 struct iterator_category_impl
 {
     using type = std::conditional_t<
-        has_advance_v<T> && has_distance_to_v<T>,
-        std::random_access_iterator_tag,
-        std::conditional_t<has_dec_v<T> || has_advance_v<T>, std::bidirectional_iterator_tag, std::forward_iterator_tag>>;
+        is_single_pass_adaptor<T>::value,
+        std::input_iterator_tag,
+        std::conditional_t<
+            has_advance_v<T> && has_distance_to_v<T>,
+            std::random_access_iterator_tag,
+            std::conditional_t<
+                has_dec_v<T> || has_advance_v<T>,
+                std::bidirectional_iterator_tag,
+                std::forward_iterator_tag>>>;
 };
 
 template <class T>
@@ -263,6 +280,19 @@ struct iterator_category_impl<T, std::void_t<typename T::iterator_category>>
     using type = typename T::iterator_category;
 };
 
+// iterators yielding proxies (e.g. a pair of references) name the type of their elements
+template <class T, class Reference, class = std::void_t<>>
+struct value_type_impl
+{
+    using type = std::decay_t<Reference>;
+};
+
+template <class T, class Reference>
+struct value_type_impl<T, Reference, std::void_t<typename T::value_type>>
+{
+    using type = typename T::value_type;
+};
+
 }  // namespace detail
 
 }  // namespace cpp_pipelines
@@ -273,7 +303,7 @@ struct std::iterator_traits<::cpp_pipelines::iterator_interface<Impl>>
     using it = ::cpp_pipelines::iterator_interface<Impl>;
     using reference = decltype(std::declval<it>().operator*());
     using pointer = decltype(std::declval<it>().operator->());
-    using value_type = std::decay_t<reference>;
+    using value_type = typename ::cpp_pipelines::detail::value_type_impl<Impl, reference>::type;
     using difference_type = typename ::cpp_pipelines::detail::difference_type_impl<Impl>::type;
     using iterator_category = typename ::cpp_pipelines::detail::iterator_category_impl<Impl>::type;
 };
@@ -1,8 +1,8 @@
 #pragma once
 
 #include <cpp_pipelines/functions.hpp>
+#include <cpp_pipelines/iter_utils.hpp>
 #include <cpp_pipelines/seq/access.hpp>
-#include <cpp_pipelines/seq/generate.hpp>
 #include <cpp_pipelines/seq/to_map.hpp>
 #include <cpp_pipelines/seq/transform.hpp>
 #include <cpp_pipelines/subrange.hpp>
@@ -65,59 +65,102 @@ struct at_fn
     }
 };
 
-struct keys_fn
+struct groups_fn
 {
-    template <class T>
-    using has_upper_bound = decltype(std::declval<T&>().upper_bound(std::declval<typename T::key_type&>()));
-
-    template <class Map>
-    struct generator
+    template <class Range>
+    struct view
     {
-        const Map* map;
-        mutable typename Map::const_iterator it;
+        Range range;
 
-        constexpr generator(const Map& map) : map{ std::addressof(map) }, it{ this->map->begin() }
+        constexpr view(Range range)
+            : range{ std::move(range) }
         {
         }
 
-        constexpr auto operator()() const -> const typename Map::key_type*
+        struct iter
         {
-            if (it != map->end())
+            using inner_iterator = iterator_t<Range>;
+            using key_reference = decltype(invoke(get_key, *std::declval<inner_iterator>()));
+            const view* parent;
+            inner_iterator it;
+            inner_iterator next;
+
+            constexpr iter() = default;
+
+            constexpr iter(const view* parent, inner_iterator it)
+                : parent{ parent }
+                , it{ it }
+                , next{ find_next(it) }
             {
-                auto& res = it->first;
-                if constexpr (is_detected_v<has_upper_bound, Map>)
-                {
-                    it = map->upper_bound(it->first);
-                }
-                else
+            }
+
+            constexpr auto deref() const -> std::pair<key_reference, subrange<inner_iterator>>
+            {
+                return { invoke(get_key, *it), subrange{ it, next } };
+            }
+
+            constexpr void inc()
+            {
+                it = next;
+                next = find_next(it);
+            }
+
+            constexpr bool is_equal(const iter& other) const
+            {
+                return it == other.it;
+            }
+
+        private:
+            constexpr inner_iterator find_next(inner_iterator b) const
+            {
+                const auto e = std::end(parent->range);
+                if (b == e)
                 {
-                    while (it != map->end() && it->first == res)
-                    {
-                        ++it;
-                    }
+                    return e;
                 }
-
-                return std::addressof(res);
+                const auto& key = invoke(get_key, *b);
+                const auto same_key = [&](const auto& item) { return invoke(get_key, item) == key; };
+                return gallop_while(b, same_key, e);
             }
-            return nullptr;
+        };
+
+        using iterator = iterator_interface<iter>;
+
+        constexpr iterator begin() const
+        {
+            return { this, std::begin(range) };
+        }
+
+        constexpr iterator end() const
+        {
+            return { this, std::end(range) };
         }
     };
 
+    template <class Range>
+    constexpr auto operator()(Range&& range) const
+    {
+        return view_interface{ view{ all(std::forward<Range>(range)) } };
+    }
+};
+
+struct keys_fn
+{
     template <class Map>
     constexpr auto operator()(Map& map) const
     {
-        return seq::generate(generator{ map });
+        return groups_fn{}(map) |= seq::transform(get_key);
     }
 };
 
 struct items_fn
 {
-    static constexpr inline auto values_at = values_at_fn{};
-
     template <class Map>
     constexpr auto operator()(Map& map) const
     {
-        return keys_fn{}(map) |= seq::transform([&](const auto& key) { return std::pair{ key, map |= values_at(key) }; });
+        return groups_fn{}(map)
+               |= seq::transform([](const auto& group)
+                                 { return std::pair{ group.first, group.second |= seq::transform(get_value) }; });
     }
 };
 
@@ -150,6 +193,7 @@ constexpr inline auto equal_range = detail::equal_range_fn{};
 constexpr inline auto values_at = detail::values_at_fn{};
 constexpr inline auto at = detail::at_fn{};
 constexpr inline auto maybe_at = detail::maybe_at_fn{};
+constexpr inline auto groups = fn(detail::groups_fn{});
 constexpr inline auto keys = fn(detail::keys_fn{});
 constexpr inline auto items = fn(detail::items_fn{});
 
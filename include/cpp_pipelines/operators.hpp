@@ -6,6 +6,49 @@ namespace cpp_pipelines
 {
 namespace detail
 {
+// an operator with one of its operands bound; the algorithms recognize the comparisons of this form
+template <class Op, class T, bool Left>
+struct bound_operator
+{
+    T value;
+
+    template <class U>
+    constexpr auto operator()(U&& item) const
+    {
+        if constexpr (Left)
+        {
+            return Op{}(value, std::forward<U>(item));
+        }
+        else
+        {
+            return Op{}(std::forward<U>(item), value);
+        }
+    }
+};
+
+// low <= item <= high
+template <class T>
+struct bound_interval
+{
+    T low;
+    T high;
+
+    template <class U>
+    constexpr bool operator()(const U& item) const
+    {
+        return low <= item && item <= high;
+    }
+};
+
+struct between_fn
+{
+    template <class T>
+    constexpr auto operator()(T low, T high) const
+    {
+        return fn(bound_interval<T>{ std::move(low), std::move(high) });
+    }
+};
+
 template <class Op>
 struct binary_operator
 {
@@ -20,13 +63,13 @@ struct binary_operator
     template <class T>
     constexpr inline auto bind_left(T value) const
     {
-        return fn([value = std::move(value)](auto&& item) { return op(value, std::forward<decltype(item)>(item)); });
+        return fn(bound_operator<Op, T, true>{ std::move(value) });
     }
 
     template <class T>
     constexpr inline auto bind_right(T value) const
     {
-        return fn([value = std::move(value)](auto&& item) { return op(std::forward<decltype(item)>(item), value); });
+        return fn(bound_operator<Op, T, false>{ std::move(value) });
     }
 
     template <class T>
@@ -54,6 +97,8 @@ constexpr auto less_equal = detail::binary_operator<std::less_equal<>>{};
 constexpr auto greater = detail::binary_operator<std::greater<>>{};
 constexpr auto greater_equal = detail::binary_operator<std::greater_equal<>>{};
 
+constexpr auto between = detail::between_fn{};
+
 constexpr auto logical_and = detail::binary_operator<std::logical_and<>>{};
 constexpr auto logical_or = detail::binary_operator<std::logical_or<>>{};
 
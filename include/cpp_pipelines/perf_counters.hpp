@@ -0,0 +1,214 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <ostream>
+
+#if defined(__linux__) && !defined(CPP_PIPELINES_NO_PERF_EVENTS)
+#define CPP_PIPELINES_PERF_EVENTS 1
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#else
+#define CPP_PIPELINES_PERF_EVENTS 0
+#endif
+
+namespace cpp_pipelines
+{
+// Counter values, or empty for the events that could not be counted. Counts of events multiplexed by the kernel are
+// extrapolated to the whole measurement.
+struct perf_report
+{
+    std::optional<double> cycles;
+    std::optional<double> instructions;
+    std::optional<double> branch_misses;
+    std::optional<double> l1d_misses;
+    std::optional<double> llc_misses;
+
+    std::optional<double> ipc() const
+    {
+        if (cycles && instructions && *cycles > 0)
+        {
+            return *instructions / *cycles;
+        }
+        return std::nullopt;
+    }
+
+    // the counts divided by the number of elements processed
+    perf_report per(std::size_t elements) const
+    {
+        const auto divide = [&](const std::optional<double>& value) -> std::optional<double>
+        {
+            if (value && elements > 0)
+            {
+                return *value / static_cast<double>(elements);
+            }
+            return std::nullopt;
+        };
+        return { divide(cycles), divide(instructions), divide(branch_misses), divide(l1d_misses), divide(llc_misses) };
+    }
+};
+
+inline std::ostream& operator<<(std::ostream& os, const perf_report& item)
+{
+    const auto field = [&](const char* name, const std::optional<double>& value)
+    {
+        os << name << "=";
+        if (value)
+        {
+            os << *value;
+        }
+        else
+        {
+            os << "n/a";
+        }
+    };
+    field("cycles", item.cycles);
+    field(" instructions", item.instructions);
+    field(" ipc", item.ipc());
+    field(" branch_misses", item.branch_misses);
+    field(" l1d_misses", item.l1d_misses);
+    field(" llc_misses", item.llc_misses);
+    return os;
+}
+
+// Counts hardware events of the calling thread (user space only) from construction, with perf_event_open on Linux.
+// When the events are not available (other systems, containers without access to the PMU, perf_event_paranoid), the
+// object still works and reports empty values.
+class perf_counters
+{
+public:
+    perf_counters()
+        : _fds{}
+    {
+        _fds.fill(-1);
+#if CPP_PIPELINES_PERF_EVENTS
+        const std::array<std::pair<std::uint32_t, std::uint64_t>, event_count> events = { {
+            { PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES },
+            { PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS },
+            { PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES },
+            { PERF_TYPE_HW_CACHE, cache_miss(PERF_COUNT_HW_CACHE_L1D) },
+            { PERF_TYPE_HW_CACHE, cache_miss(PERF_COUNT_HW_CACHE_LL) },
+        } };
+        for (std::size_t index = 0; index < event_count; ++index)
+        {
+            _fds[index] = open(events[index].first, events[index].second);
+        }
+        for (const int fd : _fds)
+        {
+            if (fd != -1)
+            {
+                ioctl(fd, PERF_EVENT_IOC_RESET, 0);
+                ioctl(fd, PERF_EVENT_IOC_ENABLE, 0);
+            }
+        }
+#endif
+    }
+
+    perf_counters(const perf_counters&) = delete;
+    perf_counters& operator=(const perf_counters&) = delete;
+
+    ~perf_counters()
+    {
+#if CPP_PIPELINES_PERF_EVENTS
+        for (const int fd : _fds)
+        {
+            if (fd != -1)
+            {
+                close(fd);
+            }
+        }
+#endif
+    }
+
+    // whether at least one event is counted
+    bool available() const
+    {
+        for (const int fd : _fds)
+        {
+            if (fd != -1)
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    // the counts since construction
+    perf_report read() const
+    {
+        return { read(_fds[0]), read(_fds[1]), read(_fds[2]), read(_fds[3]), read(_fds[4]) };
+    }
+
+private:
+    static constexpr inline std::size_t event_count = 5;
+
+#if CPP_PIPELINES_PERF_EVENTS
+    static constexpr std::uint64_t cache_miss(std::uint64_t cache)
+    {
+        return cache | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+    }
+
+    static int open(std::uint32_t type, std::uint64_t config)
+    {
+        perf_event_attr attr{};
+        attr.size = sizeof(attr);
+        attr.type = type;
+        attr.config = config;
+        attr.disabled = 1;
+        attr.exclude_kernel = 1;
+        attr.exclude_hv = 1;
+        attr.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+        return static_cast<int>(syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0));
+    }
+#endif
+
+    static std::optional<double> read([[maybe_unused]] int fd)
+    {
+#if CPP_PIPELINES_PERF_EVENTS
+        struct
+        {
+            std::uint64_t value;
+            std::uint64_t time_enabled;
+            std::uint64_t time_running;
+        } data{};
+        if (fd != -1 && ::read(fd, &data, sizeof(data)) == static_cast<ssize_t>(sizeof(data)) && data.time_running > 0)
+        {
+            return static_cast<double>(data.value) * static_cast<double>(data.time_enabled)
+                   / static_cast<double>(data.time_running);
+        }
+#endif
+        return std::nullopt;
+    }
+
+    std::array<int, event_count> _fds;
+};
+
+template <class T>
+inline void do_not_optimize(const T& item)
+{
+#if defined(__GNUC__)
+    asm volatile("" : : "g"(std::addressof(item)) : "memory");
+#else
+    static_cast<void>(item);
+#endif
+}
+
+// Iterates over the range once, returning the counters per element.
+template <class Range>
+perf_report measure_per_element(const Range& range)
+{
+    std::size_t elements = 0;
+    const perf_counters counters;
+    for (auto&& item : range)
+    {
+        do_not_optimize(item);
+        ++elements;
+    }
+    return counters.read().per(elements);
+}
+
+}  // namespace cpp_pipelines
@@ -17,30 +17,44 @@ struct pipeline_t
     std::tuple<Pipes...> pipes;
 
     template <class... Args>
-    constexpr decltype(auto) operator()(Args&&... args) const
+    constexpr decltype(auto) operator()(Args&&... args) const&
     {
-        using result_type = decltype(call<0>(std::forward<Args>(args)...));
+        return apply(*this, std::forward<Args>(args)...);
+    }
+
+    // the stages of a temporary pipeline are moved into the views they create
+    template <class... Args>
+    constexpr decltype(auto) operator()(Args&&... args) &&
+    {
+        return apply(std::move(*this), std::forward<Args>(args)...);
+    }
+
+private:
+    template <class Self, class... Args>
+    static constexpr decltype(auto) apply(Self&& self, Args&&... args)
+    {
+        using result_type = decltype(call<0>(std::forward<Self>(self), std::forward<Args>(args)...));
         if constexpr (std::is_void_v<result_type>)
         {
-            call<0>(std::forward<Args>(args)...);
+            call<0>(std::forward<Self>(self), std::forward<Args>(args)...);
         }
         else
         {
-            return to_return_type(call<0>(std::forward<Args>(args)...));
+            return to_return_type(call<0>(std::forward<Self>(self), std::forward<Args>(args)...));
         }
     }
 
-private:
-    template <std::size_t I, class... Args>
-    constexpr decltype(auto) call(Args&&... args) const
+    template <std::size_t I, class Self, class... Args>
+    static constexpr decltype(auto) call(Self&& self, Args&&... args)
     {
         if constexpr (I + 1 == sizeof...(Pipes))
         {
-            return invoke(std::get<I>(pipes), std::forward<Args>(args)...);
+            return invoke(std::get<I>(std::forward<Self>(self).pipes), std::forward<Args>(args)...);
         }
         else
         {
-            return call<I + 1>(invoke(std::get<I>(pipes), std::forward<Args>(args)...));
+            return call<I + 1>(
+                std::forward<Self>(self), invoke(std::get<I>(std::forward<Self>(self).pipes), std::forward<Args>(args)...));
         }
     }
 };
@@ -2,6 +2,7 @@
 
 #include <cpp_pipelines/opt.hpp>
 #include <cpp_pipelines/output.hpp>
+#include <cstdlib>
 #include <variant>
 
 namespace cpp_pipelines
@@ -157,16 +158,29 @@ public:
     }
 
 private:
+    // without exceptions (-fno-exceptions) a failed check aborts, as the standard library's own checks do
     constexpr void ensure_has_value() const
     {
         if (!has_value())
+        {
+#if defined(__cpp_exceptions)
             throw bad_result_access<error_type>{ std::get<error_data>(data).error };
+#else
+            std::abort();
+#endif
+        }
     }
 
     constexpr void ensure_has_error() const
     {
         if (!has_error())
+        {
+#if defined(__cpp_exceptions)
             throw bad_result_access{ "error expected, got value" };
+#else
+            std::abort();
+#endif
+        }
     }
     std::variant<value_data, error_data> data;
 };
@@ -0,0 +1,123 @@
+#pragma once
+
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+namespace cpp_pipelines
+{
+// Queue of at most 'capacity' elements in a single allocation, for sliding windows over streams. Elements are pushed
+// at the back and removed from either end; index 0 is the oldest element.
+template <class T>
+class ring_buffer
+{
+public:
+    using value_type = T;
+    using size_type = std::size_t;
+    using reference = T&;
+    using const_reference = const T&;
+
+    explicit ring_buffer(size_type capacity)
+        : _data{}
+        , _capacity{ capacity }
+        , _head{ 0 }
+        , _size{ 0 }
+    {
+        _data.reserve(capacity);
+    }
+
+    size_type capacity() const
+    {
+        return _capacity;
+    }
+
+    size_type size() const
+    {
+        return _size;
+    }
+
+    bool empty() const
+    {
+        return _size == 0;
+    }
+
+    bool full() const
+    {
+        return _size == _capacity;
+    }
+
+    // precondition: !full()
+    void push_back(T value)
+    {
+        const size_type position = wrap(_head + _size);
+        if (position == _data.size())
+        {
+            _data.push_back(std::move(value));
+        }
+        else
+        {
+            _data[position] = std::move(value);
+        }
+        ++_size;
+    }
+
+    void pop_front()
+    {
+        _head = wrap(_head + 1);
+        --_size;
+    }
+
+    void pop_back()
+    {
+        --_size;
+    }
+
+    void clear()
+    {
+        _head = 0;
+        _size = 0;
+    }
+
+    reference operator[](size_type index)
+    {
+        return _data[wrap(_head + index)];
+    }
+
+    const_reference operator[](size_type index) const
+    {
+        return _data[wrap(_head + index)];
+    }
+
+    reference front()
+    {
+        return _data[_head];
+    }
+
+    const_reference front() const
+    {
+        return _data[_head];
+    }
+
+    reference back()
+    {
+        return (*this)[_size - 1];
+    }
+
+    const_reference back() const
+    {
+        return (*this)[_size - 1];
+    }
+
+private:
+    size_type wrap(size_type index) const
+    {
+        return index >= _capacity ? index - _capacity : index;
+    }
+
+    std::vector<T> _data;
+    size_type _capacity;
+    size_type _head;
+    size_type _size;
+};
+
+}  // namespace cpp_pipelines
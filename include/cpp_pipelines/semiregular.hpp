@@ -5,68 +5,96 @@
 
 namespace cpp_pipelines
 {
-template <class Func>
-class semiregular
+namespace detail
 {
-private:
-    static constexpr bool is_default_constructible = std::is_default_constructible_v<Func>;
+// function objects that are default constructible and assignable are stored as they are, keeping the wrapper trivially
+// copyable when they are
+template <
+    class Func,
+    bool = std::is_default_constructible_v<Func> && std::is_copy_assignable_v<Func> && std::is_move_assignable_v<Func>>
+class semiregular_storage
+{
+public:
+    constexpr semiregular_storage() = default;
+
+    constexpr semiregular_storage(Func func) : _func{ std::move(func) }
+    {
+    }
+
+protected:
+    constexpr Func& get() const
+    {
+        return _func;
+    }
 
-    using impl_type = std::conditional_t<is_default_constructible, Func, std::optional<Func>>;
+private:
+    mutable Func _func;
+};
 
+// others (e.g. lambdas) are kept in an optional and assigned by reconstruction
+template <class Func>
+class semiregular_storage<Func, false>
+{
 public:
-    constexpr semiregular() = default;
+    constexpr semiregular_storage() = default;
 
-    constexpr semiregular(Func func) : _func{ std::move(func) }
+    constexpr semiregular_storage(Func func) : _func{ std::move(func) }
     {
     }
 
-    constexpr semiregular(const semiregular&) = default;
+    constexpr semiregular_storage(const semiregular_storage&) = default;
 
-    constexpr semiregular(semiregular&&) = default;
+    constexpr semiregular_storage(semiregular_storage&&) = default;
 
-    constexpr semiregular& operator=(semiregular other)
+    constexpr semiregular_storage& operator=(const semiregular_storage& other)
     {
-        if constexpr (std::is_assignable_v<impl_type, impl_type>)
-        {
-            _func = std::move(other._func);
-        }
-        else
+        if (this != &other)
         {
-            _func.~impl_type();
-            new (&_func) impl_type{ std::move(other._func) };
+            assign(other._func);
         }
         return *this;
     }
 
-    template <class... Args>
-    constexpr decltype(auto) operator()(Args&&... args) const
+    constexpr semiregular_storage& operator=(semiregular_storage&& other)
     {
-        return invoke(get(), std::forward<Args>(args)...);
+        assign(std::move(other._func));
+        return *this;
     }
 
-    template <class... Args>
-    constexpr decltype(auto) operator()(Args&&... args)
+protected:
+    constexpr Func& get() const
     {
-        return invoke(get(), std::forward<Args>(args)...);
+        return *_func;
     }
 
 private:
-    constexpr decltype(auto) get() const
+    template <class Opt>
+    constexpr void assign(Opt&& other)
     {
-        if constexpr (is_default_constructible)
-            return _func;
-        else
-            return *_func;
+        _func.reset();
+        if (other)
+        {
+            _func.emplace(*std::forward<Opt>(other));
+        }
     }
 
-    constexpr decltype(auto) get()
+    mutable std::optional<Func> _func;
+};
+
+}  // namespace detail
+
+template <class Func>
+class semiregular : public detail::semiregular_storage<Func>
+{
+public:
+    using detail::semiregular_storage<Func>::semiregular_storage;
+
+    constexpr semiregular() = default;
+
+    template <class... Args>
+    constexpr decltype(auto) operator()(Args&&... args) const
     {
-        if constexpr (is_default_constructible)
-            return _func;
-        else
-            return *_func;
+        return invoke(this->get(), std::forward<Args>(args)...);
     }
-
-    mutable impl_type _func;
 };
-}  // namespace cpp_pipelines
\ No newline at end of file
+}  // namespace cpp_pipelines
@@ -4,8 +4,12 @@
 #include <cpp_pipelines/seq/accumulate.hpp>
 #include <cpp_pipelines/seq/adjacent.hpp>
 #include <cpp_pipelines/seq/adjacent_transform.hpp>
+#include <cpp_pipelines/seq/batch.hpp>
+#include <cpp_pipelines/seq/bucket_by_alternative.hpp>
+#include <cpp_pipelines/seq/cache_all.hpp>
 #include <cpp_pipelines/seq/cache_latest.hpp>
 #include <cpp_pipelines/seq/chunk.hpp>
+#include <cpp_pipelines/seq/collect_result.hpp>
 #include <cpp_pipelines/seq/concat.hpp>
 #include <cpp_pipelines/seq/copy.hpp>
 #include <cpp_pipelines/seq/distance.hpp>
@@ -14,19 +18,28 @@
 #include <cpp_pipelines/seq/drop_while.hpp>
 #include <cpp_pipelines/seq/empty.hpp>
 #include <cpp_pipelines/seq/enumerate.hpp>
+#include <cpp_pipelines/seq/explain.hpp>
+#include <cpp_pipelines/seq/fanout.hpp>
 #include <cpp_pipelines/seq/filter.hpp>
 #include <cpp_pipelines/seq/for_each.hpp>
 #include <cpp_pipelines/seq/generate.hpp>
 #include <cpp_pipelines/seq/getlines.hpp>
+#include <cpp_pipelines/seq/hash_join.hpp>
 #include <cpp_pipelines/seq/inspect.hpp>
 #include <cpp_pipelines/seq/intersperse.hpp>
 #include <cpp_pipelines/seq/istream.hpp>
 #include <cpp_pipelines/seq/iterate.hpp>
 #include <cpp_pipelines/seq/join.hpp>
+#include <cpp_pipelines/seq/match.hpp>
+#include <cpp_pipelines/seq/merge_join.hpp>
 #include <cpp_pipelines/seq/numeric.hpp>
+#include <cpp_pipelines/seq/permute.hpp>
 #include <cpp_pipelines/seq/predicates.hpp>
 #include <cpp_pipelines/seq/repeat.hpp>
 #include <cpp_pipelines/seq/reverse.hpp>
+#include <cpp_pipelines/seq/route.hpp>
+#include <cpp_pipelines/seq/set_operations.hpp>
+#include <cpp_pipelines/seq/sort_external.hpp>
 #include <cpp_pipelines/seq/split.hpp>
 #include <cpp_pipelines/seq/stride.hpp>
 #include <cpp_pipelines/seq/take.hpp>
@@ -35,11 +48,14 @@
 #include <cpp_pipelines/seq/to.hpp>
 #include <cpp_pipelines/seq/to_map.hpp>
 #include <cpp_pipelines/seq/transform.hpp>
+#include <cpp_pipelines/seq/transform_batch.hpp>
 #include <cpp_pipelines/seq/transform_join.hpp>
 #include <cpp_pipelines/seq/transform_maybe.hpp>
+#include <cpp_pipelines/seq/transform_res.hpp>
 #include <cpp_pipelines/seq/trim_while.hpp>
 #include <cpp_pipelines/seq/unfold.hpp>
 #include <cpp_pipelines/seq/views.hpp>
+#include <cpp_pipelines/seq/window_aggregate.hpp>
 #include <cpp_pipelines/seq/write.hpp>
 #include <cpp_pipelines/seq/zip.hpp>
 #include <cpp_pipelines/seq/zip_transform.hpp>
@@ -1,12 +1,52 @@
 #pragma once
 
 #include <cpp_pipelines/pipeline.hpp>
+#include <cpp_pipelines/seq/transform.hpp>
+#include <cpp_pipelines/simd/reduce.hpp>
+#include <cpp_pipelines/subrange.hpp>
 #include <numeric>
+#include <optional>
 
 namespace cpp_pipelines::seq
 {
 namespace detail
 {
+// integral sums of contiguous values (or of a transform over them) are exact in any order, so they can be vectorized
+template <class Range, class T, class = void>
+struct vectorizable_sum : std::false_type
+{
+};
+
+template <class Range, class T>
+struct vectorizable_sum<Range, T, std::enable_if_t<is_contiguous_range<Range>::value>>
+    : std::bool_constant<
+          std::is_integral_v<T> && simd::is_vectorizable<T>::value && std::is_same_v<range_value_t<Range>, T>>
+{
+    template <class R>
+    static T sum(const R& range, T init)
+    {
+        const auto span = as_span(range);
+        return static_cast<T>(init + simd::sum(span.begin(), span.end()));
+    }
+};
+
+template <class Func, class Inner, class T>
+struct vectorizable_sum<
+    view_interface<transform_fn::view<Func, Inner>>,
+    T,
+    std::enable_if_t<is_contiguous_range<Inner>::value>>
+    : std::bool_constant<
+          std::is_integral_v<T> && simd::is_vectorizable<T>::value && simd::is_vectorizable<range_value_t<Inner>>::value
+          && std::is_same_v<range_value_t<view_interface<transform_fn::view<Func, Inner>>>, T>>
+{
+    static T sum(const view_interface<transform_fn::view<Func, Inner>>& range, T init)
+    {
+        const auto span = as_span(range.impl.range);
+        return simd::transform_sum(
+            span.begin(), span.end(), init, [&](const auto& item) { return invoke(range.impl.func, item); });
+    }
+};
+
 struct accumulate_fn
 {
     template <class BinaryFunc, class T>
@@ -18,7 +58,14 @@ struct accumulate_fn
         template <class Range>
         constexpr auto operator()(Range&& range) const
         {
-            return std::accumulate(std::begin(range), std::end(range), init, std::ref(func));
+            if constexpr (std::is_same_v<BinaryFunc, std::plus<>> && vectorizable_sum<std::decay_t<Range>, T>::value)
+            {
+                return vectorizable_sum<std::decay_t<Range>, T>::sum(range, init);
+            }
+            else
+            {
+                return std::accumulate(std::begin(range), std::end(range), init, std::ref(func));
+            }
         }
     };
 
@@ -41,6 +88,27 @@ struct accumulate_fn
         }
     };
 
+    // std::nullopt for an empty range instead of throwing
+    template <class BinaryFunc>
+    struct maybe_impl
+    {
+        BinaryFunc func;
+
+        template <class Range>
+        constexpr auto operator()(Range&& range) const
+        {
+            using value_type = range_value_t<std::decay_t<Range>>;
+            const auto b = std::begin(range);
+            const auto e = std::end(range);
+            if (b == e)
+            {
+                return std::optional<value_type>{};
+            }
+            const value_type init = *b;
+            return std::optional<value_type>{ std::accumulate(std::next(b), e, init, std::ref(func)) };
+        }
+    };
+
     template <class BinaryFunc, class T>
     constexpr auto operator()(BinaryFunc func, T init) const
     {
@@ -53,6 +121,16 @@ struct accumulate_fn
         return fn(impl<BinaryFunc, void>{ std::move(func) });
     }
 };
+
+struct maybe_accumulate_fn
+{
+    template <class BinaryFunc>
+    constexpr auto operator()(BinaryFunc func) const
+    {
+        return fn(accumulate_fn::maybe_impl<BinaryFunc>{ std::move(func) });
+    }
+};
 }  // namespace detail
 static constexpr inline auto accumulate = detail::accumulate_fn{};
+static constexpr inline auto maybe_accumulate = detail::maybe_accumulate_fn{};
 }  // namespace cpp_pipelines::seq
\ No newline at end of file
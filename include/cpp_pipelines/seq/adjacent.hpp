@@ -1,26 +1,135 @@
 #pragma once
 
-#include <cpp_pipelines/seq/drop.hpp>
-#include <cpp_pipelines/seq/zip.hpp>
+#include <array>
+#include <cpp_pipelines/pipeline.hpp>
+#include <cpp_pipelines/seq/views.hpp>
+#include <optional>
+#include <tuple>
 
 namespace cpp_pipelines::seq
 {
 namespace detail
 {
+template <class T, std::size_t>
+using repeat_t = T;
+
+// The last N elements are kept in a circular buffer inside the iterator, so every upstream element is evaluated once
+// and input ranges are supported. Lvalues of forward ranges are kept by address and yielded as they are; other elements
+// are copied into the buffer and yielded by value, so the tuples stay valid when the iterator moves on.
 template <std::size_t N>
 struct adjacent_fn
 {
+    static_assert(N > 0, "adjacent: N > 0 required");
+
     template <class Range>
-    constexpr auto operator()(Range&& range) const
+    struct view
     {
-        return call(std::forward<Range>(range), std::make_index_sequence<N>{});
-    }
+        Range range;
+
+        constexpr view(Range range)
+            : range{ std::move(range) }
+        {
+        }
+
+        struct iter
+        {
+            using inner_iterator = iterator_t<Range>;
+            using inner_reference = iter_reference_t<inner_iterator>;
+            using iterator_category = std::conditional_t<
+                is_forward_iterator<inner_iterator>::value,
+                std::forward_iterator_tag,
+                std::input_iterator_tag>;
+
+            static constexpr bool by_address
+                = std::is_lvalue_reference_v<inner_reference> && is_forward_iterator<inner_iterator>::value;
+
+            using slot_type = std::conditional_t<
+                by_address,
+                std::add_pointer_t<inner_reference>,
+                std::optional<std::decay_t<inner_reference>>>;
+            using element_reference = std::conditional_t<by_address, inner_reference, std::decay_t<inner_reference>>;
+
+            const view* parent;
+            // 'it' is past the newest element of the window, which starts at window[head]
+            inner_iterator it;
+            std::array<slot_type, N> window;
+            std::size_t head;
+            bool done;
+
+            constexpr iter() = default;
+
+            constexpr iter(const view* parent, inner_iterator it, bool done)
+                : parent{ parent }
+                , it{ it }
+                , window{}
+                , head{ 0 }
+                , done{ done }
+            {
+                for (std::size_t i = 0; i < N && !this->done; ++i)
+                {
+                    this->done = !push(i);
+                }
+            }
 
-private:
-    template <class Range, std::size_t... I>
-    constexpr auto call(Range&& range, std::index_sequence<I...>) const
+            constexpr auto deref() const
+            {
+                return deref(std::make_index_sequence<N>{});
+            }
+
+            constexpr void inc()
+            {
+                done = !push(head);
+                head = head + 1 == N ? 0 : head + 1;
+            }
+
+            constexpr bool is_equal(const iter& other) const
+            {
+                return done == other.done && (done || it == other.it);
+            }
+
+        private:
+            constexpr bool push(std::size_t index)
+            {
+                if (it == std::end(parent->range))
+                {
+                    return false;
+                }
+                if constexpr (by_address)
+                {
+                    window[index] = std::addressof(*it);
+                }
+                else
+                {
+                    window[index].emplace(*it);
+                }
+                ++it;
+                return true;
+            }
+
+            template <std::size_t... I>
+            constexpr auto deref(std::index_sequence<I...>) const
+            {
+                return std::tuple<repeat_t<element_reference, I>...>{ *window[(head + I) % N]... };
+            }
+        };
+
+        using iterator = iterator_interface<iter>;
+
+        constexpr iterator begin() const
+        {
+            return { this, std::begin(range), false };
+        }
+
+        constexpr iterator end() const
+        {
+            return { this, std::end(range), true };
+        }
+    };
+
+    template <class Range>
+    constexpr auto operator()(Range&& range) const
     {
-        return zip((range |= drop(I))...);
+        return view_interface{ view{ all(std::forward<Range>(range)) } };
     }
 };
 
@@ -30,4 +139,4 @@ template <std::size_t N>
 static constexpr inline auto adjacent = fn(detail::adjacent_fn<N>{});
 static constexpr inline auto pairwise = adjacent<2>;
 
-}  // namespace cpp_pipelines::seq
\ No newline at end of file
+}  // namespace cpp_pipelines::seq
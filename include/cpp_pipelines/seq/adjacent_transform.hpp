@@ -1,7 +1,7 @@
 #pragma once
 
-#include <cpp_pipelines/seq/drop.hpp>
-#include <cpp_pipelines/seq/zip_transform.hpp>
+#include <cpp_pipelines/seq/adjacent.hpp>
+#include <cpp_pipelines/seq/transform.hpp>
 
 namespace cpp_pipelines::seq
 {
@@ -21,16 +21,17 @@ struct adjacent_transform_fn
         }
 
         template <class Range>
-        constexpr auto operator()(Range&& range) const
+        constexpr auto operator()(Range&& range) const&
         {
-            return call(std::forward<Range>(range), std::make_index_sequence<N>{});
+            return std::forward<Range>(range) |= adjacent<N> |= transform(
+                       [func = func](const auto& items) -> decltype(auto) { return std::apply(func, items); });
         }
 
-    private:
-        template <class Range, std::size_t... I>
-        constexpr auto call(Range&& range, std::index_sequence<I...>) const
+        template <class Range>
+        constexpr auto operator()(Range&& range) &&
         {
-            return std::tuple{ (range |= drop(I))... } >>= seq::zip_transform(func);
+            return std::forward<Range>(range) |= adjacent<N> |= transform(
+                       [func = std::move(func)](const auto& items) -> decltype(auto) { return std::apply(func, items); });
         }
     };
 
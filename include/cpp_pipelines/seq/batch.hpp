@@ -0,0 +1,124 @@
+#pragma once
+
+#include <cpp_pipelines/pipeline.hpp>
+#include <cpp_pipelines/seq/views.hpp>
+#include <cpp_pipelines/subrange.hpp>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+namespace cpp_pipelines::seq
+{
+namespace detail
+{
+struct batch_fn
+{
+    template <class Range>
+    struct view
+    {
+        using element_type = range_value_t<Range>;
+
+        Range range;
+        std::ptrdiff_t size;
+
+        constexpr view(Range range, std::ptrdiff_t size)
+            : range{ std::move(range) }
+            , size{ size }
+        {
+        }
+
+        // Every batch is copied into the same buffer, so a span is only valid until the iterator is incremented.
+        struct iter
+        {
+            using iterator_category = std::input_iterator_tag;
+            using inner_iterator = iterator_t<Range>;
+            const view* parent;
+            inner_iterator it;
+            std::shared_ptr<std::vector<element_type>> buffer;
+            std::ptrdiff_t count;
+
+            constexpr iter() = default;
+
+            iter(const view* parent, inner_iterator it)
+                : parent{ parent }
+                , it{ it }
+                , buffer{}
+                , count{ 0 }
+            {
+                if (it != std::end(parent->range))
+                {
+                    buffer = std::make_shared<std::vector<element_type>>();
+                    buffer->reserve(parent->size);
+                    fill();
+                }
+            }
+
+            span<element_type> deref() const
+            {
+                return { buffer->data(), buffer->data() + count };
+            }
+
+            void inc()
+            {
+                fill();
+            }
+
+            bool is_equal(const iter& other) const
+            {
+                return it == other.it && count == other.count;
+            }
+
+        private:
+            void fill()
+            {
+                const auto end = std::end(parent->range);
+                buffer->clear();
+                for (; it != end && static_cast<std::ptrdiff_t>(buffer->size()) < parent->size; ++it)
+                {
+                    buffer->push_back(*it);
+                }
+                count = static_cast<std::ptrdiff_t>(buffer->size());
+            }
+        };
+
+        using iterator = iterator_interface<iter>;
+
+        iterator begin() const
+        {
+            return { this, std::begin(range) };
+        }
+
+        iterator end() const
+        {
+            return { this, std::end(range) };
+        }
+    };
+
+    struct impl
+    {
+        std::ptrdiff_t size;
+
+        template <class Range>
+        constexpr auto operator()(Range&& range) const
+        {
+            return view_interface{ view{ all(std::forward<Range>(range)), size } };
+        }
+    };
+
+    // a template, like the other stages that validate their arguments, so that the throw is only instantiated when used
+    template <class Size, class = std::enable_if_t<std::is_integral_v<Size>>>
+    constexpr auto operator()(Size size) const
+    {
+        if (size <= 0)
+        {
+            throw std::invalid_argument{ "seq::batch: positive size required" };
+        }
+        return fn(impl{ static_cast<std::ptrdiff_t>(size) });
+    }
+};
+
+}  // namespace detail
+
+static constexpr inline auto batch = detail::batch_fn{};
+
+}  // namespace cpp_pipelines::seq
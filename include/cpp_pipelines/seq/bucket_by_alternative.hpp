@@ -0,0 +1,110 @@
+#pragma once
+
+#include <cpp_pipelines/pipeline.hpp>
+#include <cpp_pipelines/seq/views.hpp>
+#include <cpp_pipelines/subrange.hpp>
+#include <cpp_pipelines/var.hpp>
+#include <stdexcept>
+#include <tuple>
+#include <variant>
+#include <vector>
+
+namespace cpp_pipelines::seq
+{
+namespace detail
+{
+struct bucket_by_alternative_fn
+{
+    template <class Handler>
+    struct impl
+    {
+        Handler handler;
+        // 0: the whole range at once
+        std::size_t batch_size;
+
+        template <class Range>
+        auto operator()(Range&& range) const&
+        {
+            using variant_type = range_value_t<std::decay_t<Range>>;
+            run<variant_type>(range, std::make_index_sequence<std::variant_size_v<variant_type>>{});
+            return handler;
+        }
+
+        // the handler of a temporary stage is moved out instead of copied
+        template <class Range>
+        auto operator()(Range&& range) &&
+        {
+            using variant_type = range_value_t<std::decay_t<Range>>;
+            run<variant_type>(range, std::make_index_sequence<std::variant_size_v<variant_type>>{});
+            return std::move(handler);
+        }
+
+    private:
+        template <class Variant, class Range, std::size_t... I>
+        void run(Range& range, std::index_sequence<I...>) const
+        {
+            std::tuple<std::vector<std::variant_alternative_t<I, Variant>>...> buckets;
+            std::size_t count = 0;
+            for (auto&& item : range)
+            {
+                const std::size_t index = item.index();
+                const bool pushed
+                    = ((index == I
+                        && (std::get<I>(buckets).push_back(std::get<I>(std::forward<decltype(item)>(item))), true))
+                       || ...);
+                if (!pushed)
+                {
+                    throw std::bad_variant_access{};
+                }
+                if (++count == batch_size)
+                {
+                    (flush(std::get<I>(buckets)), ...);
+                    count = 0;
+                }
+            }
+            (flush(std::get<I>(buckets)), ...);
+        }
+
+        template <class T>
+        void flush(std::vector<T>& bucket) const
+        {
+            if (!bucket.empty())
+            {
+                invoke(handler, const_span<T>{ bucket.data(), bucket.data() + bucket.size() });
+                bucket.clear();
+            }
+        }
+    };
+
+    template <class... Handlers>
+    constexpr auto operator()(Handlers... handlers) const
+    {
+        auto handler = var::overloaded{ std::move(handlers)... };
+        return fn(impl<decltype(handler)>{ std::move(handler), 0 });
+    }
+};
+
+struct bucket_by_alternative_batched_fn
+{
+    template <class... Handlers>
+    constexpr auto operator()(std::size_t batch_size, Handlers... handlers) const
+    {
+        if (batch_size == 0)
+        {
+            throw std::invalid_argument{ "seq::bucket_by_alternative_batched: positive batch size required" };
+        }
+        auto handler = var::overloaded{ std::move(handlers)... };
+        return fn(bucket_by_alternative_fn::impl<decltype(handler)>{ std::move(handler), batch_size });
+    }
+};
+
+}  // namespace detail
+
+// Distributes the variants of the range into a contiguous buffer per alternative, holding the unwrapped values, and
+// calls the handler accepting const_span<T> for each non-empty buffer, so every type is processed in its own loop.
+// The order of the elements is kept within an alternative only. bucket_by_alternative hands the buffers over at the end
+// of the range, bucket_by_alternative_batched every 'batch_size' elements. Returns the handlers.
+static constexpr inline auto bucket_by_alternative = detail::bucket_by_alternative_fn{};
+static constexpr inline auto bucket_by_alternative_batched = detail::bucket_by_alternative_batched_fn{};
+
+}  // namespace cpp_pipelines::seq
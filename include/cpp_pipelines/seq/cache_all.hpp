@@ -0,0 +1,152 @@
+#pragma once
+
+#include <cpp_pipelines/pipeline.hpp>
+#include <cpp_pipelines/seq/views.hpp>
+#include <memory>
+#include <optional>
+#include <vector>
+
+namespace cpp_pipelines::seq
+{
+namespace detail
+{
+// The elements of 'range' computed so far, in chunks whose capacity is reserved up front, so their addresses are
+// stable while more elements are added. Not synchronized: the iterators sharing it belong to one thread.
+template <class Range>
+class cache_all_storage
+{
+public:
+    using value_type = range_value_t<Range>;
+
+    static constexpr inline std::size_t chunk_size = 256;
+
+    explicit cache_all_storage(Range range)
+        : _range{ std::move(range) }
+        , _it{}
+        , _chunks{}
+        , _size{ 0 }
+        , _done{ false }
+    {
+    }
+
+    // whether the element at 'index' exists; computes the elements before it that are not cached yet
+    bool reach(std::size_t index)
+    {
+        if (!_it && !_done)
+        {
+            _it.emplace(std::begin(_range));
+        }
+        while (_size <= index && !_done)
+        {
+            if (*_it == std::end(_range))
+            {
+                _done = true;
+                _it.reset();
+                break;
+            }
+            if (_size % chunk_size == 0)
+            {
+                _chunks.emplace_back().reserve(chunk_size);
+            }
+            _chunks.back().push_back(**_it);
+            ++_size;
+            ++*_it;
+        }
+        return index < _size;
+    }
+
+    const value_type& operator[](std::size_t index) const
+    {
+        return _chunks[index / chunk_size][index % chunk_size];
+    }
+
+private:
+    Range _range;
+    std::optional<iterator_t<Range>> _it;
+    std::vector<std::vector<value_type>> _chunks;
+    std::size_t _size;
+    bool _done;
+};
+
+struct cache_all_fn
+{
+    template <class Range>
+    struct view
+    {
+        using storage_type = cache_all_storage<Range>;
+
+        std::shared_ptr<storage_type> storage;
+
+        constexpr view(Range range)
+            : storage{ std::make_shared<storage_type>(std::move(range)) }
+        {
+        }
+
+        // the end iterator has no position; any other one compares equal to it once the source has no element there
+        struct iter
+        {
+            static constexpr inline std::size_t npos = static_cast<std::size_t>(-1);
+
+            storage_type* storage;
+            std::size_t index;
+
+            constexpr iter() = default;
+
+            constexpr iter(storage_type* storage, std::size_t index)
+                : storage{ storage }
+                , index{ index }
+            {
+            }
+
+            const typename storage_type::value_type& deref() const
+            {
+                storage->reach(index);
+                return (*storage)[index];
+            }
+
+            void inc()
+            {
+                ++index;
+            }
+
+            bool is_equal(const iter& other) const
+            {
+                const bool end = at_end();
+                return end == other.at_end() && (end || index == other.index);
+            }
+
+        private:
+            bool at_end() const
+            {
+                return index == npos || !storage->reach(index);
+            }
+        };
+
+        using iterator = iterator_interface<iter>;
+
+        iterator begin() const
+        {
+            return { storage.get(), std::size_t{ 0 } };
+        }
+
+        iterator end() const
+        {
+            return { storage.get(), iter::npos };
+        }
+    };
+
+    template <class Range>
+    constexpr auto operator()(Range&& range) const
+    {
+        return view_interface{ view{ all(std::forward<Range>(range)) } };
+    }
+};
+
+}  // namespace detail
+
+// Computes every element of the range once, when an iterator first reaches it, and keeps it: the view is forward even
+// over single pass sources, and the copies of the view and their iterators share the cached elements.
+static constexpr inline auto cache_all = fn(detail::cache_all_fn{});
+static constexpr inline auto memoize = cache_all;
+
+}  // namespace cpp_pipelines::seq
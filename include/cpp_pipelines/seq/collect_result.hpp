@@ -0,0 +1,39 @@
+#pragma once
+
+#include <cpp_pipelines/pipeline.hpp>
+#include <cpp_pipelines/res.hpp>
+#include <cpp_pipelines/seq/views.hpp>
+#include <vector>
+
+namespace cpp_pipelines::seq
+{
+namespace detail
+{
+struct collect_result_fn
+{
+    template <class Range>
+    auto operator()(Range&& range) const
+    {
+        using item_type = range_value_t<std::decay_t<Range>>;
+        using value_type = typename item_type::value_type;
+        using result_type = result<std::vector<value_type>, typename item_type::error_type>;
+        std::vector<value_type> values;
+        for (auto&& item : range)
+        {
+            if (item.has_error())
+            {
+                return result_type{ ::cpp_pipelines::error(std::forward<decltype(item)>(item).error()) };
+            }
+            values.push_back(*std::forward<decltype(item)>(item));
+        }
+        return result_type{ std::move(values) };
+    }
+};
+
+}  // namespace detail
+
+// Turns a range of result<T, E> into a result<std::vector<T>, E> in a single pass: the values, or the first error, where
+// the traversal stops.
+static constexpr inline auto collect_result = fn(detail::collect_result_fn{});
+
+}  // namespace cpp_pipelines::seq
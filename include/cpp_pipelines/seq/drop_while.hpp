@@ -26,7 +26,7 @@ struct drop_while_fn
 
         constexpr iterator begin() const
         {
-            return advance_while(std::begin(range), pred, std::end(range));
+            return advance_while(std::begin(range), std::cref(pred), std::end(range));
         }
 
         constexpr iterator end() const
@@ -41,10 +41,16 @@ struct drop_while_fn
         Pred pred;
 
         template <class Range>
-        constexpr auto operator()(Range&& range) const
+        constexpr auto operator()(Range&& range) const&
         {
             return view_interface{ view{ all(std::forward<Range>(range)), pred } };
         }
+
+        template <class Range>
+        constexpr auto operator()(Range&& range) &&
+        {
+            return view_interface{ view{ all(std::forward<Range>(range)), std::move(pred) } };
+        }
     };
 
     template <class Pred>
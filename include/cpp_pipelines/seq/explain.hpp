@@ -0,0 +1,299 @@
+#pragma once
+
+#include <algorithm>
+#include <cpp_pipelines/debug.hpp>
+#include <cpp_pipelines/seq/views.hpp>
+#include <memory>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <vector>
+
+namespace cpp_pipelines::seq
+{
+enum class iterator_kind
+{
+    input,
+    forward,
+    bidirectional,
+    random_access
+};
+
+inline std::ostream& operator<<(std::ostream& os, iterator_kind item)
+{
+    switch (item)
+    {
+        case iterator_kind::input: return os << "input";
+        case iterator_kind::forward: return os << "forward";
+        case iterator_kind::bidirectional: return os << "bidirectional";
+        case iterator_kind::random_access: return os << "random_access";
+    }
+    return os;
+}
+
+struct stage_description
+{
+    // e.g. "seq::filter", "ref", "owning", or the type of a container
+    std::string name;
+    iterator_kind category;
+    std::size_t iterator_size;
+    std::size_t view_size;
+    bool trivially_copyable_iterator;
+    // random access, or a container with size()
+    bool sized;
+    bool contiguous;
+    // the elements are owned outside of the views (through seq::ref): copying the view does not copy them
+    bool borrowed;
+    // the stage owns its source through a shared_ptr (seq::owning, used by all() for rvalues)
+    bool shared_owner;
+    // the category is weaker than the weakest one of the inputs
+    bool downgraded;
+    std::size_t inputs;
+};
+
+struct range_description
+{
+    // from the sources to the outermost view; the inputs of a stage precede it
+    std::vector<stage_description> stages;
+
+    bool downgraded() const
+    {
+        return std::any_of(stages.begin(), stages.end(), [](const stage_description& s) { return s.downgraded; });
+    }
+};
+
+inline std::ostream& operator<<(std::ostream& os, const range_description& item)
+{
+    for (const stage_description& s : item.stages)
+    {
+        os << s.name << ": " << s.category << (s.downgraded ? " (downgraded)" : "") << ", iterator " << s.iterator_size
+           << " B" << (s.trivially_copyable_iterator ? "" : " (not trivially copyable)") << ", view " << s.view_size
+           << " B" << (s.sized ? ", sized" : "") << (s.contiguous ? ", contiguous" : "")
+           << (s.borrowed ? ", borrowed" : "") << (s.shared_owner ? ", shared_ptr owner" : "") << "\n";
+    }
+    return os;
+}
+
+namespace detail
+{
+template <class T>
+struct explain_source
+{
+    using type = T;
+    static constexpr inline bool shared = false;
+    static constexpr inline bool by_reference = false;
+};
+
+template <class T>
+struct explain_source<std::shared_ptr<T>>
+{
+    using type = T;
+    static constexpr inline bool shared = true;
+    static constexpr inline bool by_reference = false;
+};
+
+template <class T>
+struct explain_source<T*>
+{
+    using type = T;
+    static constexpr inline bool shared = false;
+    static constexpr inline bool by_reference = true;
+};
+
+// the ranges a view is built on: its 'range' member (the one of the views holding a single range), or the elements of its
+// 'ranges' tuple; views holding their sources otherwise end the walk
+template <class Range, class = void>
+struct explain_inputs
+{
+    using type = std::tuple<>;
+};
+
+template <class Impl>
+struct explain_inputs<view_interface<Impl>, std::void_t<decltype(std::declval<const Impl&>().range)>>
+{
+    using source = explain_source<std::decay_t<decltype(Impl::range)>>;
+    using type = std::tuple<std::remove_cv_t<typename source::type>>;
+};
+
+template <class Impl>
+struct explain_inputs<view_interface<Impl>, std::void_t<decltype(std::get<0>(std::declval<const Impl&>().ranges))>>
+{
+    using type = std::decay_t<decltype(Impl::ranges)>;
+};
+
+template <class Range, class = void>
+struct explain_source_of : explain_source<void>
+{
+};
+
+template <class Impl>
+struct explain_source_of<view_interface<Impl>, std::void_t<decltype(std::declval<const Impl&>().range)>>
+    : explain_source<std::decay_t<decltype(Impl::range)>>
+{
+};
+
+template <class Range>
+using explain_iterator_t = decltype(std::begin(std::declval<const Range&>()));
+
+template <class Range>
+using explain_size_t = decltype(std::size(std::declval<const Range&>()));
+
+template <class Range>
+constexpr iterator_kind iterator_kind_of()
+{
+    using iterator = explain_iterator_t<Range>;
+    if constexpr (is_random_access_iterator<iterator>::value)
+    {
+        return iterator_kind::random_access;
+    }
+    else if constexpr (is_bidirectional_iterator<iterator>::value)
+    {
+        return iterator_kind::bidirectional;
+    }
+    else if constexpr (is_forward_iterator<iterator>::value)
+    {
+        return iterator_kind::forward;
+    }
+    else
+    {
+        return iterator_kind::input;
+    }
+}
+
+template <class... Inputs>
+constexpr bool is_downgraded(iterator_kind kind, std::tuple<Inputs...>*)
+{
+    if constexpr (sizeof...(Inputs) == 0)
+    {
+        return false;
+    }
+    else
+    {
+        return kind < std::min({ iterator_kind_of<Inputs>()... });
+    }
+}
+
+template <class Range>
+constexpr bool is_downgraded_stage()
+{
+    return is_downgraded(iterator_kind_of<Range>(), static_cast<typename explain_inputs<Range>::type*>(nullptr));
+}
+
+// "cpp_pipelines::seq::detail::filter_fn::view<...>" is shown as "seq::filter"
+inline std::string stage_name(std::string name)
+{
+    const auto view = name.find("::view<");
+    if (view == std::string::npos)
+    {
+        return name;
+    }
+    name.erase(view);
+    if (const auto args = name.find('<'); args != std::string::npos)
+    {
+        name.erase(args);
+    }
+    for (const std::string_view part : { "cpp_pipelines::", "detail::" })
+    {
+        for (auto pos = name.find(part); pos != std::string::npos; pos = name.find(part))
+        {
+            name.erase(pos, part.size());
+        }
+    }
+    if (name.size() > 3 && name.compare(name.size() - 3, 3, "_fn") == 0)
+    {
+        name.erase(name.size() - 3);
+    }
+    return name;
+}
+
+template <class Range>
+std::string stage_name()
+{
+    if constexpr (is_view_interface<Range>::value)
+    {
+        return stage_name(std::string{ type_name<decltype(Range::impl)>() });
+    }
+    else
+    {
+        return std::string{ type_name<Range>() };
+    }
+}
+
+template <class Range, class... Inputs>
+void explain_stages(std::vector<stage_description>& stages, std::tuple<Inputs...>*)
+{
+    bool borrowed = sizeof...(Inputs) > 0;
+    (
+        [&]
+        {
+            explain_stages<Inputs>(stages, static_cast<typename explain_inputs<Inputs>::type*>(nullptr));
+            borrowed = borrowed && stages.back().borrowed;
+        }(),
+        ...);
+
+    using source = explain_source_of<Range>;
+    using iterator = explain_iterator_t<Range>;
+    stage_description result;
+    result.name = stage_name<Range>();
+    result.category = iterator_kind_of<Range>();
+    result.iterator_size = sizeof(iterator);
+    result.view_size = sizeof(Range);
+    result.trivially_copyable_iterator = std::is_trivially_copyable_v<iterator>;
+    result.sized = is_random_access_iterator<iterator>::value
+                   || (!is_view_interface<Range>::value && is_detected_v<explain_size_t, Range>);
+    result.contiguous = is_contiguous_range<Range>::value;
+    result.borrowed = source::by_reference || (!source::shared && borrowed);
+    result.shared_owner = source::shared;
+    result.downgraded = is_downgraded_stage<Range>();
+    result.inputs = sizeof...(Inputs);
+    stages.push_back(std::move(result));
+}
+
+template <class Stage>
+[[deprecated("seq::warn_category_downgrades: this stage weakens the iterator category of its inputs")]] constexpr void
+category_downgraded()
+{
+}
+
+template <class Range, class... Inputs>
+constexpr void warn_category_downgrades(std::tuple<Inputs...>*)
+{
+    (warn_category_downgrades<Inputs>(static_cast<typename explain_inputs<Inputs>::type*>(nullptr)), ...);
+    if constexpr (is_downgraded_stage<Range>())
+    {
+        category_downgraded<Range>();
+    }
+}
+
+struct explain_fn
+{
+    template <class Range>
+    range_description operator()(const Range&) const
+    {
+        range_description result;
+        explain_stages<Range>(result.stages, static_cast<typename explain_inputs<Range>::type*>(nullptr));
+        return result;
+    }
+};
+
+struct warn_category_downgrades_fn
+{
+    template <class Range>
+    constexpr void operator()(const Range&) const
+    {
+        warn_category_downgrades<Range>(static_cast<typename explain_inputs<Range>::type*>(nullptr));
+    }
+};
+
+}  // namespace detail
+
+// Describes the stages a view is made of, from its sources: the name of each one, the category and size of its
+// iterator, the size of the view, and how the elements are held. Everything is derived from the type of the view.
+static constexpr inline auto explain = detail::explain_fn{};
+
+// Opt in check: the call emits a deprecation warning, naming the stage in its instantiation trace, for every stage of the
+// view whose iterator category is weaker than the one of its inputs (e.g. seq::filter over a random access range).
+static constexpr inline auto warn_category_downgrades = detail::warn_category_downgrades_fn{};
+
+}  // namespace cpp_pipelines::seq
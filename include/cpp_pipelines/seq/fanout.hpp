@@ -0,0 +1,263 @@
+#pragma once
+
+#include <array>
+#include <condition_variable>
+#include <cpp_pipelines/pipeline.hpp>
+#include <cpp_pipelines/seq/views.hpp>
+#include <deque>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <tuple>
+#include <vector>
+
+namespace cpp_pipelines::seq
+{
+namespace detail
+{
+// Bounded queue of blocks of elements between the thread reading the source and the thread running one sink.
+template <class T>
+class fanout_channel
+{
+public:
+    using block_type = std::shared_ptr<const std::vector<T>>;
+
+    static constexpr inline std::size_t capacity = 8;
+
+    // false once the sink has stopped reading
+    bool push(block_type block)
+    {
+        std::unique_lock lock{ _mutex };
+        _not_full.wait(lock, [&] { return _blocks.size() < capacity || _abandoned; });
+        if (_abandoned)
+        {
+            return false;
+        }
+        _blocks.push_back(std::move(block));
+        _not_empty.notify_one();
+        return true;
+    }
+
+    void close()
+    {
+        std::lock_guard lock{ _mutex };
+        _closed = true;
+        _not_empty.notify_one();
+    }
+
+    // The next block, or nullptr at the end of the input. The last block taken stays alive with the channel, so the sink
+    // may return references to the elements it saw last.
+    const std::vector<T>* next()
+    {
+        std::unique_lock lock{ _mutex };
+        _not_empty.wait(lock, [&] { return !_blocks.empty() || _closed; });
+        if (_blocks.empty())
+        {
+            return nullptr;
+        }
+        _current = std::move(_blocks.front());
+        _blocks.pop_front();
+        _not_full.notify_one();
+        return _current.get();
+    }
+
+    void abandon()
+    {
+        std::lock_guard lock{ _mutex };
+        _abandoned = true;
+        _blocks.clear();
+        _not_full.notify_one();
+    }
+
+private:
+    std::mutex _mutex;
+    std::condition_variable _not_empty;
+    std::condition_variable _not_full;
+    std::deque<block_type> _blocks;
+    block_type _current;
+    bool _closed = false;
+    bool _abandoned = false;
+};
+
+// The input range seen by a sink: the elements of the source as const references into the blocks of its channel.
+template <class T>
+struct fanout_view
+{
+    fanout_channel<T>* channel;
+
+    struct iter
+    {
+        using iterator_category = std::input_iterator_tag;
+        fanout_channel<T>* channel;
+        const std::vector<T>* block;
+        std::size_t index;
+
+        constexpr iter() = default;
+
+        constexpr iter(fanout_channel<T>* channel, const std::vector<T>* block)
+            : channel{ channel }
+            , block{ block }
+            , index{ 0 }
+        {
+        }
+
+        const T& deref() const
+        {
+            return (*block)[index];
+        }
+
+        void inc()
+        {
+            if (++index == block->size())
+            {
+                block = channel->next();
+                index = 0;
+            }
+        }
+
+        bool is_equal(const iter& other) const
+        {
+            return block == other.block && index == other.index;
+        }
+    };
+
+    using iterator = iterator_interface<iter>;
+
+    iterator begin() const
+    {
+        return { channel, channel->next() };
+    }
+
+    iterator end() const
+    {
+        return { channel, nullptr };
+    }
+};
+
+template <class T, class Sink>
+using fanout_result_t = std::decay_t<std::invoke_result_t<const Sink&, view_interface<fanout_view<T>>>>;
+
+// runs on the thread of the sink
+template <class T, class Sink, class Result>
+void fanout_consume(const Sink& sink, fanout_channel<T>& channel, Result& result, std::exception_ptr& error)
+{
+    try
+    {
+        result.emplace(invoke(sink, view_interface{ fanout_view<T>{ &channel } }));
+    }
+    catch (...)
+    {
+        error = std::current_exception();
+    }
+    channel.abandon();
+}
+
+struct fanout_fn
+{
+    static constexpr inline std::size_t block_size = 1024;
+
+    template <class... Sinks>
+    struct impl
+    {
+        std::tuple<Sinks...> sinks;
+
+        template <class Range>
+        auto operator()(Range&& range) const
+        {
+            return run<range_value_t<std::decay_t<Range>>>(range, std::index_sequence_for<Sinks...>{});
+        }
+
+    private:
+        template <class T, class Range, std::size_t... I>
+        auto run(Range& range, std::index_sequence<I...>) const
+        {
+            static_assert(
+                (!std::is_void_v<fanout_result_t<T, Sinks>> && ...), "seq::fanout: every sink has to return a value");
+
+            std::array<fanout_channel<T>, sizeof...(Sinks)> channels;
+            std::tuple<std::optional<fanout_result_t<T, Sinks>>...> results;
+            std::array<std::exception_ptr, sizeof...(Sinks) + 1> errors;
+
+            // Sinks block while waiting for data, so they get their own threads rather than the execution pool.
+            std::array<std::thread, sizeof...(Sinks)> threads = { std::thread{
+                [&] { fanout_consume<T>(std::get<I>(sinks), channels[I], std::get<I>(results), errors[I + 1]); } }... };
+
+            try
+            {
+                produce<T>(range, channels);
+            }
+            catch (...)
+            {
+                errors[0] = std::current_exception();
+            }
+            for (auto& channel : channels)
+            {
+                channel.close();
+            }
+            for (auto& thread : threads)
+            {
+                thread.join();
+            }
+            for (const auto& error : errors)
+            {
+                if (error)
+                {
+                    std::rethrow_exception(error);
+                }
+            }
+            return std::tuple<fanout_result_t<T, Sinks>...>{ std::move(*std::get<I>(results))... };
+        }
+
+        template <class T, class Range, class Channels>
+        static void produce(Range& range, Channels& channels)
+        {
+            std::vector<T> block;
+            block.reserve(block_size);
+            for (auto&& item : range)
+            {
+                block.push_back(std::forward<decltype(item)>(item));
+                if (block.size() == block_size && !publish(block, channels))
+                {
+                    return;
+                }
+            }
+            if (!block.empty())
+            {
+                publish(block, channels);
+            }
+        }
+
+        // false once every sink is done
+        template <class T, class Channels>
+        static bool publish(std::vector<T>& block, Channels& channels)
+        {
+            const auto shared = std::make_shared<const std::vector<T>>(std::move(block));
+            block = std::vector<T>{};
+            block.reserve(block_size);
+            bool active = false;
+            for (auto& channel : channels)
+            {
+                active = channel.push(shared) || active;
+            }
+            return active;
+        }
+    };
+
+    template <class... Sinks>
+    constexpr auto operator()(Sinks... sinks) const
+    {
+        static_assert(sizeof...(Sinks) > 0, "seq::fanout: at least one sink required");
+        return fn(impl<Sinks...>{ { std::move(sinks)... } });
+    }
+};
+
+}  // namespace detail
+
+// Runs every sink (any terminal pipeline, e.g. 'filter(pred) |= to_vector') over the same range in a single traversal
+// and returns a tuple of their results. The elements are copied in blocks and handed to each sink on its own thread as
+// an input range of const references; reading stops once every sink has returned.
+static constexpr inline auto fanout = detail::fanout_fn{};
+
+}  // namespace cpp_pipelines::seq
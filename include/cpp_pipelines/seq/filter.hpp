@@ -98,10 +98,16 @@ struct filter_fn
         Pred pred;
 
         template <class Range>
-        constexpr auto operator()(Range&& range) const
+        constexpr auto operator()(Range&& range) const&
         {
             return view_interface{ view{ pred, all(std::forward<Range>(range)) } };
         }
+
+        template <class Range>
+        constexpr auto operator()(Range&& range) &&
+        {
+            return view_interface{ view{ std::move(pred), all(std::forward<Range>(range)) } };
+        }
     };
 
     template <class Pred>
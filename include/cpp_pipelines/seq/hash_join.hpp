@@ -0,0 +1,422 @@
+#pragma once
+
+#include <cpp_pipelines/opt/optional_ref.hpp>
+#include <cpp_pipelines/pipeline.hpp>
+#include <cpp_pipelines/seq/filter.hpp>
+#include <cpp_pipelines/seq/views.hpp>
+#include <functional>
+#include <memory>
+#include <vector>
+
+namespace cpp_pipelines::seq
+{
+namespace detail
+{
+struct default_hash
+{
+    template <class T>
+    std::size_t operator()(const T& item) const
+    {
+        return std::hash<T>{}(item);
+    }
+};
+
+// Open addressing table (linear probing, at most half full) from the distinct keys of the build side to the positions
+// of their elements. The positions of equal keys are linked through 'next' in the order of the build range, so there is
+// no allocation per element.
+template <class Key, class Hash, class Equal>
+class hash_join_index
+{
+public:
+    static constexpr inline std::size_t npos = static_cast<std::size_t>(-1);
+
+    hash_join_index(std::size_t size, Hash hash, Equal equal)
+        : _hash{ std::move(hash) }
+        , _equal{ std::move(equal) }
+        , _slots{}
+        , _keys{}
+        , _groups{}
+        , _next{}
+        , _mask{ 0 }
+    {
+        std::size_t capacity = 8;
+        while (capacity < 2 * size)
+        {
+            capacity *= 2;
+        }
+        _slots.resize(capacity, slot{ 0, npos });
+        _mask = capacity - 1;
+        _next.reserve(size);
+    }
+
+    // positions are inserted in increasing order, starting from 0
+    void insert(Key key, std::size_t position)
+    {
+        const std::size_t hash = mix(_hash(key));
+        _next.push_back(npos);
+        for (std::size_t index = hash & _mask;; index = (index + 1) & _mask)
+        {
+            slot& s = _slots[index];
+            if (s.group == npos)
+            {
+                s = slot{ hash, _keys.size() };
+                _keys.push_back(std::move(key));
+                _groups.push_back(group{ position, position });
+                return;
+            }
+            if (s.hash == hash && invoke(_equal, _keys[s.group], key))
+            {
+                _next[_groups[s.group].tail] = position;
+                _groups[s.group].tail = position;
+                return;
+            }
+        }
+    }
+
+    // the first position of an element with the given key, or npos
+    template <class K>
+    std::size_t find(const K& key) const
+    {
+        const std::size_t hash = hash_of(key);
+        for (std::size_t index = hash & _mask;; index = (index + 1) & _mask)
+        {
+            const slot& s = _slots[index];
+            if (s.group == npos)
+            {
+                return npos;
+            }
+            if (s.hash == hash && invoke(_equal, _keys[s.group], key))
+            {
+                return _groups[s.group].head;
+            }
+        }
+    }
+
+    std::size_t next(std::size_t position) const
+    {
+        return _next[position];
+    }
+
+private:
+    struct slot
+    {
+        std::size_t hash;
+        std::size_t group;
+    };
+
+    struct group
+    {
+        std::size_t head;
+        std::size_t tail;
+    };
+
+    template <class T, class = void>
+    struct is_transparent : std::false_type
+    {
+    };
+
+    template <class T>
+    struct is_transparent<T, std::void_t<typename T::is_transparent>> : std::true_type
+    {
+    };
+
+    // a probe key of another type (e.g. a const char* looked up among strings) is hashed as a Key, unless the hash
+    // function is transparent: equal keys of different types need not have equal hashes otherwise
+    template <class K>
+    std::size_t hash_of(const K& key) const
+    {
+        if constexpr (std::is_same_v<K, Key> || is_transparent<Hash>::value)
+        {
+            return mix(_hash(key));
+        }
+        else
+        {
+            return mix(_hash(static_cast<Key>(key)));
+        }
+    }
+
+    // std::hash of integers is the identity, whose low bits alone would select the slot
+    static std::size_t mix(std::size_t hash)
+    {
+        return static_cast<std::size_t>((static_cast<std::uint64_t>(hash) * 0x9E3779B97F4A7C15ull) >> 16);
+    }
+
+    Hash _hash;
+    Equal _equal;
+    std::vector<slot> _slots;
+    std::vector<Key> _keys;
+    std::vector<group> _groups;
+    std::vector<std::size_t> _next;
+    std::size_t _mask;
+};
+
+// The build range with its index; lvalues of forward ranges are referred to by address, other elements are copied.
+template <class Build, class BuildKey, class Hash, class Equal>
+class hash_join_table
+{
+public:
+    using value_type = range_value_t<Build>;
+    using key_type = std::decay_t<std::invoke_result_t<const BuildKey&, const value_type&>>;
+
+    static constexpr inline std::size_t npos = hash_join_index<key_type, Hash, Equal>::npos;
+
+    hash_join_table(Build build, const BuildKey& build_key, Hash hash, Equal equal)
+        : _build{ std::move(build) }
+        , _elements{ collect(_build) }
+        , _index{ _elements.size(), std::move(hash), std::move(equal) }
+    {
+        for (std::size_t position = 0; position < _elements.size(); ++position)
+        {
+            _index.insert(invoke(build_key, element(position)), position);
+        }
+    }
+
+    const value_type& element(std::size_t position) const
+    {
+        if constexpr (by_address)
+        {
+            return *_elements[position];
+        }
+        else
+        {
+            return _elements[position];
+        }
+    }
+
+    template <class K>
+    std::size_t find(const K& key) const
+    {
+        return _index.find(key);
+    }
+
+    std::size_t next(std::size_t position) const
+    {
+        return _index.next(position);
+    }
+
+private:
+    static constexpr bool by_address
+        = std::is_lvalue_reference_v<range_reference_t<Build>> && is_forward_range<Build>::value;
+
+    using element_type = std::conditional_t<by_address, const value_type*, value_type>;
+
+    static std::vector<element_type> collect(const Build& build)
+    {
+        std::vector<element_type> result;
+        for (auto&& item : build)
+        {
+            if constexpr (by_address)
+            {
+                result.push_back(std::addressof(item));
+            }
+            else
+            {
+                result.push_back(std::forward<decltype(item)>(item));
+            }
+        }
+        return result;
+    }
+
+    Build _build;
+    std::vector<element_type> _elements;
+    hash_join_index<key_type, Hash, Equal> _index;
+};
+
+template <bool Left>
+struct hash_join_fn
+{
+    template <class Table, class ProbeKey, class Probe>
+    struct view
+    {
+        std::shared_ptr<const Table> table;
+        ProbeKey probe_key;
+        Probe probe;
+
+        constexpr view(std::shared_ptr<const Table> table, ProbeKey probe_key, Probe probe)
+            : table{ std::move(table) }
+            , probe_key{ std::move(probe_key) }
+            , probe{ std::move(probe) }
+        {
+        }
+
+        struct iter
+        {
+            using inner_iterator = iterator_t<Probe>;
+            using probe_reference = iter_reference_t<inner_iterator>;
+            using build_reference = std::
+                conditional_t<Left, optional_ref<const typename Table::value_type>, const typename Table::value_type&>;
+
+            const view* parent;
+            inner_iterator it;
+            // position of the build element matched with *it, npos for an unmatched element of a left join
+            std::size_t match;
+
+            constexpr iter() = default;
+
+            constexpr iter(const view* parent, inner_iterator it)
+                : parent{ parent }
+                , it{ it }
+                , match{ Table::npos }
+            {
+                seek();
+            }
+
+            constexpr std::pair<probe_reference, build_reference> deref() const
+            {
+                if constexpr (Left)
+                {
+                    return { *it, match == Table::npos ? build_reference{} : std::cref(parent->table->element(match)) };
+                }
+                else
+                {
+                    return { *it, parent->table->element(match) };
+                }
+            }
+
+            constexpr void inc()
+            {
+                if (match != Table::npos && (match = parent->table->next(match)) != Table::npos)
+                {
+                    return;
+                }
+                ++it;
+                seek();
+            }
+
+            constexpr bool is_equal(const iter& other) const
+            {
+                return it == other.it && match == other.match;
+            }
+
+        private:
+            constexpr void seek()
+            {
+                for (; it != std::end(parent->probe); ++it)
+                {
+                    match = parent->table->find(invoke(parent->probe_key, *it));
+                    if (Left || match != Table::npos)
+                    {
+                        return;
+                    }
+                }
+                match = Table::npos;
+            }
+        };
+
+        using iterator = iterator_interface<iter>;
+
+        constexpr iterator begin() const
+        {
+            return { this, std::begin(probe) };
+        }
+
+        constexpr iterator end() const
+        {
+            return { this, std::end(probe) };
+        }
+    };
+
+    template <class Build, class BuildKey, class ProbeKey, class Hash, class Equal>
+    struct impl
+    {
+        Build build;
+        BuildKey build_key;
+        ProbeKey probe_key;
+        Hash hash;
+        Equal equal;
+
+        template <class Probe>
+        auto operator()(Probe&& probe) const&
+        {
+            using table_type = hash_join_table<Build, BuildKey, Hash, Equal>;
+            auto table = std::make_shared<const table_type>(build, build_key, hash, equal);
+            return view_interface{ view{ std::move(table), probe_key, all(std::forward<Probe>(probe)) } };
+        }
+
+        template <class Probe>
+        auto operator()(Probe&& probe) &&
+        {
+            using table_type = hash_join_table<Build, BuildKey, Hash, Equal>;
+            auto table = std::make_shared<const table_type>(std::move(build), build_key, std::move(hash), std::move(equal));
+            return view_interface{ view{ std::move(table), std::move(probe_key), all(std::forward<Probe>(probe)) } };
+        }
+    };
+
+    template <class Build, class BuildKey, class ProbeKey, class Hash = default_hash, class Equal = std::equal_to<>>
+    auto operator()(Build&& build, BuildKey build_key, ProbeKey probe_key, Hash hash = {}, Equal equal = {}) const
+    {
+        using build_type = decltype(all(std::forward<Build>(build)));
+        return fn(impl<build_type, BuildKey, ProbeKey, Hash, Equal>{ all(std::forward<Build>(build)),
+                                                                     std::move(build_key),
+                                                                     std::move(probe_key),
+                                                                     std::move(hash),
+                                                                     std::move(equal) });
+    }
+};
+
+template <class Table, class ProbeKey>
+struct hash_semi_join_pred
+{
+    std::shared_ptr<const Table> table;
+    ProbeKey probe_key;
+
+    template <class T>
+    bool operator()(const T& item) const
+    {
+        return table->find(invoke(probe_key, item)) != Table::npos;
+    }
+};
+
+struct hash_semi_join_fn
+{
+    template <class Build, class BuildKey, class ProbeKey, class Hash, class Equal>
+    struct impl
+    {
+        Build build;
+        BuildKey build_key;
+        ProbeKey probe_key;
+        Hash hash;
+        Equal equal;
+
+        template <class Probe>
+        auto operator()(Probe&& probe) const&
+        {
+            using table_type = hash_join_table<Build, BuildKey, Hash, Equal>;
+            auto table = std::make_shared<const table_type>(build, build_key, hash, equal);
+            return std::forward<Probe>(probe)
+                   |= filter(hash_semi_join_pred<table_type, ProbeKey>{ std::move(table), probe_key });
+        }
+
+        template <class Probe>
+        auto operator()(Probe&& probe) &&
+        {
+            using table_type = hash_join_table<Build, BuildKey, Hash, Equal>;
+            auto table = std::make_shared<const table_type>(std::move(build), build_key, std::move(hash), std::move(equal));
+            return std::forward<Probe>(probe)
+                   |= filter(hash_semi_join_pred<table_type, ProbeKey>{ std::move(table), std::move(probe_key) });
+        }
+    };
+
+    template <class Build, class BuildKey, class ProbeKey, class Hash = default_hash, class Equal = std::equal_to<>>
+    auto operator()(Build&& build, BuildKey build_key, ProbeKey probe_key, Hash hash = {}, Equal equal = {}) const
+    {
+        using build_type = decltype(all(std::forward<Build>(build)));
+        return fn(impl<build_type, BuildKey, ProbeKey, Hash, Equal>{ all(std::forward<Build>(build)),
+                                                                     std::move(build_key),
+                                                                     std::move(probe_key),
+                                                                     std::move(hash),
+                                                                     std::move(equal) });
+    }
+};
+
+}  // namespace detail
+
+// Joins the elements of the range (the probe side) with those of 'build' whose keys are equal, using a flat hash table
+// of the build side built when the pipeline is applied. hash_join yields (probe element, const build element&) pairs
+// for every match, hash_left_join also the unmatched probe elements paired with an empty optional_ref, and
+// hash_semi_join the probe elements that have a match.
+static constexpr inline auto hash_join = detail::hash_join_fn<false>{};
+static constexpr inline auto hash_left_join = detail::hash_join_fn<true>{};
+static constexpr inline auto hash_semi_join = detail::hash_semi_join_fn{};
+
+}  // namespace cpp_pipelines::seq
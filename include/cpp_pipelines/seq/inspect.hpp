@@ -90,10 +90,16 @@ struct inspect_fn
         Func func;
 
         template <class Range>
-        constexpr auto operator()(Range&& range) const
+        constexpr auto operator()(Range&& range) const&
         {
             return view_interface{ view{ func, all(std::forward<Range>(range)) } };
         }
+
+        template <class Range>
+        constexpr auto operator()(Range&& range) &&
+        {
+            return view_interface{ view{ std::move(func), all(std::forward<Range>(range)) } };
+        }
     };
 
     template <class Func>
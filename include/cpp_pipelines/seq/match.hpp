@@ -0,0 +1,24 @@
+#pragma once
+
+#include <cpp_pipelines/seq/transform.hpp>
+#include <cpp_pipelines/var.hpp>
+
+namespace cpp_pipelines::seq
+{
+namespace detail
+{
+struct match_fn
+{
+    template <class... Funcs>
+    constexpr auto operator()(Funcs... funcs) const
+    {
+        return transform(var::match(std::move(funcs)...));
+    }
+};
+
+}  // namespace detail
+
+// Replaces each variant of the range with the result of the function handling its alternative (see var::match).
+static constexpr inline auto match = detail::match_fn{};
+
+}  // namespace cpp_pipelines::seq
@@ -0,0 +1,164 @@
+#pragma once
+
+#include <cpp_pipelines/pipeline.hpp>
+#include <cpp_pipelines/seq/views.hpp>
+#include <functional>
+
+namespace cpp_pipelines::seq
+{
+namespace detail
+{
+struct merge_join_fn
+{
+    template <class Build, class BuildKey, class ProbeKey, class Compare, class Probe>
+    struct view
+    {
+        static_assert(is_forward_range<Build>::value, "merge_join: forward build range required");
+
+        Build build;
+        BuildKey build_key;
+        ProbeKey probe_key;
+        Compare compare;
+        Probe probe;
+
+        constexpr view(Build build, BuildKey build_key, ProbeKey probe_key, Compare compare, Probe probe)
+            : build{ std::move(build) }
+            , build_key{ std::move(build_key) }
+            , probe_key{ std::move(probe_key) }
+            , compare{ std::move(compare) }
+            , probe{ std::move(probe) }
+        {
+        }
+
+        struct iter
+        {
+            using inner_iterator = iterator_t<Probe>;
+            using build_iterator = iterator_t<Build>;
+            using reference = std::pair<iter_reference_t<inner_iterator>, iter_reference_t<build_iterator>>;
+
+            const view* parent;
+            inner_iterator it;
+            // the first build element with the key of *it, and the one paired with it; probe elements with equal keys
+            // go over the same group again
+            build_iterator group;
+            build_iterator current;
+
+            constexpr iter() = default;
+
+            constexpr iter(const view* parent, inner_iterator it)
+                : parent{ parent }
+                , it{ it }
+                , group{ std::begin(parent->build) }
+                , current{ std::end(parent->build) }
+            {
+                seek();
+            }
+
+            constexpr reference deref() const
+            {
+                return { *it, *current };
+            }
+
+            constexpr void inc()
+            {
+                if (++current != std::end(parent->build)
+                    && !invoke(parent->compare, invoke(parent->probe_key, *it), invoke(parent->build_key, *current)))
+                {
+                    return;
+                }
+                ++it;
+                seek();
+            }
+
+            constexpr bool is_equal(const iter& other) const
+            {
+                return it == other.it && current == other.current;
+            }
+
+        private:
+            constexpr void seek()
+            {
+                const auto build_end = std::end(parent->build);
+                for (; it != std::end(parent->probe); ++it)
+                {
+                    // the element is bound first: a key projected from a prvalue element must not outlive it
+                    auto&& item = *it;
+                    auto&& key = invoke(parent->probe_key, item);
+                    while (group != build_end && invoke(parent->compare, invoke(parent->build_key, *group), key))
+                    {
+                        ++group;
+                    }
+                    if (group == build_end)
+                    {
+                        it = std::end(parent->probe);
+                        break;
+                    }
+                    if (!invoke(parent->compare, key, invoke(parent->build_key, *group)))
+                    {
+                        current = group;
+                        return;
+                    }
+                }
+                current = build_end;
+            }
+        };
+
+        using iterator = iterator_interface<iter>;
+
+        constexpr iterator begin() const
+        {
+            return { this, std::begin(probe) };
+        }
+
+        constexpr iterator end() const
+        {
+            return { this, std::end(probe) };
+        }
+    };
+
+    template <class Build, class BuildKey, class ProbeKey, class Compare>
+    struct impl
+    {
+        Build build;
+        BuildKey build_key;
+        ProbeKey probe_key;
+        Compare compare;
+
+        template <class Probe>
+        constexpr auto operator()(Probe&& probe) const&
+        {
+            using probe_type = decltype(all(std::forward<Probe>(probe)));
+            return view_interface{ view<Build, BuildKey, ProbeKey, Compare, probe_type>{
+                build, build_key, probe_key, compare, all(std::forward<Probe>(probe)) } };
+        }
+
+        template <class Probe>
+        constexpr auto operator()(Probe&& probe) &&
+        {
+            using probe_type = decltype(all(std::forward<Probe>(probe)));
+            return view_interface{ view<Build, BuildKey, ProbeKey, Compare, probe_type>{
+                std::move(build),
+                std::move(build_key),
+                std::move(probe_key),
+                std::move(compare),
+                all(std::forward<Probe>(probe)) } };
+        }
+    };
+
+    template <class Build, class BuildKey, class ProbeKey, class Compare = std::less<>>
+    constexpr auto operator()(Build&& build, BuildKey build_key, ProbeKey probe_key, Compare compare = {}) const
+    {
+        using build_type = decltype(all(std::forward<Build>(build)));
+        return fn(impl<build_type, BuildKey, ProbeKey, Compare>{
+            all(std::forward<Build>(build)), std::move(build_key), std::move(probe_key), std::move(compare) });
+    }
+};
+
+}  // namespace detail
+
+// Joins two ranges sorted by their keys ('compare' orders the keys): yields a (probe element, build element) pair for
+// every build element whose key equals the key of the probe element, in a single lazy pass over both. The build range
+// has to be forward, as its groups of equal keys are visited again for repeated probe keys.
+static constexpr inline auto merge_join = detail::merge_join_fn{};
+
+}  // namespace cpp_pipelines::seq
@@ -0,0 +1,109 @@
+#pragma once
+
+#include <cpp_pipelines/pipeline.hpp>
+#include <cpp_pipelines/seq/views.hpp>
+
+namespace cpp_pipelines::seq
+{
+namespace detail
+{
+struct permute_fn
+{
+    template <class Range, class Indices>
+    struct view
+    {
+        Range range;
+        Indices indices;
+
+        constexpr view(Range range, Indices indices)
+            : range{ std::move(range) }
+            , indices{ std::move(indices) }
+        {
+        }
+
+        struct iter
+        {
+            using inner_iterator = iterator_t<Indices>;
+            const view* parent;
+            inner_iterator it;
+
+            constexpr iter() = default;
+
+            constexpr iter(const view* parent, inner_iterator it)
+                : parent{ parent }
+                , it{ it }
+            {
+            }
+
+            constexpr range_reference_t<Range> deref() const
+            {
+                return std::begin(parent->range)[*it];
+            }
+
+            constexpr void inc()
+            {
+                ++it;
+            }
+
+            constexpr bool is_equal(const iter& other) const
+            {
+                return it == other.it;
+            }
+
+            template <class It = inner_iterator, class = std::enable_if_t<is_bidirectional_iterator<It>::value>>
+            constexpr void dec()
+            {
+                --it;
+            }
+
+            template <class It = inner_iterator, class = std::enable_if_t<is_random_access_iterator<It>::value>>
+            constexpr void advance(iter_difference_t<It> offset)
+            {
+                it += offset;
+            }
+
+            template <class It = inner_iterator, class = std::enable_if_t<is_random_access_iterator<It>::value>>
+            constexpr iter_difference_t<It> distance_to(const iter& other) const
+            {
+                return other.it - it;
+            }
+        };
+
+        using iterator = iterator_interface<iter>;
+
+        constexpr iterator begin() const
+        {
+            return { this, std::begin(indices) };
+        }
+
+        constexpr iterator end() const
+        {
+            return { this, std::end(indices) };
+        }
+    };
+
+    template <class Indices>
+    struct impl
+    {
+        Indices indices;
+
+        template <class Range>
+        constexpr auto operator()(Range&& range) const
+        {
+            static_assert(is_random_access_range<Range>::value, "permute: random access range required");
+            return view_interface{ view{ all(std::forward<Range>(range)), indices } };
+        }
+    };
+
+    template <class Indices>
+    constexpr auto operator()(Indices&& indices) const
+    {
+        return fn(impl<decltype(all(std::forward<Indices>(indices)))>{ all(std::forward<Indices>(indices)) });
+    }
+};
+
+}  // namespace detail
+
+static constexpr inline auto permute = detail::permute_fn{};
+
+}  // namespace cpp_pipelines::seq
@@ -0,0 +1,258 @@
+#pragma once
+
+#include <cpp_pipelines/pipeline.hpp>
+#include <cpp_pipelines/seq/fanout.hpp>
+#include <iterator>
+#include <stdexcept>
+
+namespace cpp_pipelines::seq
+{
+namespace detail
+{
+template <class Sink, class = std::void_t<>>
+struct is_output_sink : std::false_type
+{
+};
+
+template <class Sink>
+struct is_output_sink<Sink, std::void_t<typename std::iterator_traits<Sink>::iterator_category>> : std::true_type
+{
+};
+
+// an output iterator is written to as the elements arrive
+template <class T, class Sink>
+class route_output
+{
+public:
+    using result_type = Sink;
+
+    explicit route_output(Sink out)
+        : _out{ std::move(out) }
+    {
+    }
+
+    template <class U>
+    void push(U&& item)
+    {
+        *_out = std::forward<U>(item);
+        ++_out;
+    }
+
+    result_type finish()
+    {
+        return _out;
+    }
+
+private:
+    Sink _out;
+};
+
+// a pipeline reads its elements on its own thread, in blocks, as a sink of seq::fanout does
+template <class T, class Sink>
+class route_pipeline
+{
+public:
+    using result_type = fanout_result_t<T, Sink>;
+
+    explicit route_pipeline(const Sink& sink)
+        : _channel{}
+        , _block{}
+        , _result{}
+        , _error{}
+        , _thread{ [this, &sink] { fanout_consume<T>(sink, _channel, _result, _error); } }
+    {
+        _block.reserve(fanout_fn::block_size);
+    }
+
+    route_pipeline(const route_pipeline&) = delete;
+    route_pipeline& operator=(const route_pipeline&) = delete;
+
+    ~route_pipeline()
+    {
+        if (_thread.joinable())
+        {
+            _channel.close();
+            _thread.join();
+        }
+    }
+
+    template <class U>
+    void push(U&& item)
+    {
+        _block.push_back(std::forward<U>(item));
+        if (_block.size() == fanout_fn::block_size)
+        {
+            publish();
+        }
+    }
+
+    result_type finish()
+    {
+        if (!_block.empty())
+        {
+            publish();
+        }
+        _channel.close();
+        _thread.join();
+        if (_error)
+        {
+            std::rethrow_exception(_error);
+        }
+        return std::move(*_result);
+    }
+
+private:
+    void publish()
+    {
+        _channel.push(std::make_shared<const std::vector<T>>(std::move(_block)));
+        _block = std::vector<T>{};
+        _block.reserve(fanout_fn::block_size);
+    }
+
+    fanout_channel<T> _channel;
+    std::vector<T> _block;
+    std::optional<result_type> _result;
+    std::exception_ptr _error;
+    std::thread _thread;
+};
+
+template <class T, class Sink>
+using route_sink_t = std::conditional_t<is_output_sink<Sink>::value, route_output<T, Sink>, route_pipeline<T, Sink>>;
+
+struct route_fn
+{
+    template <class KeyFunc, class... Sinks>
+    struct impl
+    {
+        KeyFunc key_fn;
+        std::tuple<Sinks...> sinks;
+        std::size_t batch_size;
+
+        template <class Range>
+        auto operator()(Range&& range) const&
+        {
+            return run<range_value_t<std::decay_t<Range>>>(*this, range, std::index_sequence_for<Sinks...>{});
+        }
+
+        // the output iterator sinks of a temporary stage are moved into the states
+        template <class Range>
+        auto operator()(Range&& range) &&
+        {
+            return run<range_value_t<std::decay_t<Range>>>(std::move(*this), range, std::index_sequence_for<Sinks...>{});
+        }
+
+    private:
+        template <class T, class Self, class Range, std::size_t... I>
+        static auto run(Self&& self, Range& range, std::index_sequence<I...>)
+        {
+            const auto& key_fn = self.key_fn;
+            const std::size_t batch_size = self.batch_size;
+            std::tuple<route_sink_t<T, Sinks>...> states{ std::get<I>(std::forward<Self>(self).sinks)... };
+            if (batch_size == 0)
+            {
+                for (auto&& item : range)
+                {
+                    const std::size_t index = index_of(invoke(key_fn, item));
+                    ((index == I && (std::get<I>(states).push(std::forward<decltype(item)>(item)), true)) || ...);
+                }
+            }
+            else
+            {
+                std::vector<T> items;
+                std::vector<std::size_t> indices;
+                items.reserve(batch_size);
+                indices.reserve(batch_size);
+                for (auto&& item : range)
+                {
+                    items.push_back(std::forward<decltype(item)>(item));
+                    indices.push_back(index_of(invoke(key_fn, items.back())));
+                    if (items.size() == batch_size)
+                    {
+                        (flush<I>(items, indices, std::get<I>(states)), ...);
+                        items.clear();
+                        indices.clear();
+                    }
+                }
+                (flush<I>(items, indices, std::get<I>(states)), ...);
+            }
+            return std::tuple<typename route_sink_t<T, Sinks>::result_type...>{ std::get<I>(states).finish()... };
+        }
+
+        // one pass over the batch per sink, so the loops do not branch on the sink type
+        template <std::size_t I, class T, class State>
+        static void flush(std::vector<T>& items, const std::vector<std::size_t>& indices, State& state)
+        {
+            for (std::size_t i = 0; i < items.size(); ++i)
+            {
+                if (indices[i] == I)
+                {
+                    state.push(std::move(items[i]));
+                }
+            }
+        }
+
+        template <class Key>
+        static std::size_t index_of(const Key& key)
+        {
+            const auto index = static_cast<std::size_t>(key);
+            if (index >= sizeof...(Sinks))
+            {
+                throw std::out_of_range{ "seq::route: key out of range" };
+            }
+            return index;
+        }
+    };
+
+    template <class KeyFunc, class... Sinks>
+    constexpr auto operator()(KeyFunc key_fn, Sinks... sinks) const
+    {
+        static_assert(sizeof...(Sinks) > 0, "seq::route: at least one sink required");
+        return fn(impl<KeyFunc, Sinks...>{ std::move(key_fn), { std::move(sinks)... }, 0 });
+    }
+};
+
+struct route_batched_fn
+{
+    template <class KeyFunc, class... Sinks>
+    constexpr auto operator()(std::size_t batch_size, KeyFunc key_fn, Sinks... sinks) const
+    {
+        if (batch_size == 0)
+        {
+            throw std::invalid_argument{ "seq::route_batched: positive batch size required" };
+        }
+        return fn(route_fn::impl<KeyFunc, Sinks...>{ std::move(key_fn), { std::move(sinks)... }, batch_size });
+    }
+};
+
+template <class Pred>
+struct partition_key
+{
+    Pred pred;
+
+    template <class T>
+    constexpr std::size_t operator()(const T& item) const
+    {
+        return invoke(pred, item) ? 0 : 1;
+    }
+};
+
+struct partition_into_fn
+{
+    template <class Pred, class SinkTrue, class SinkFalse>
+    constexpr auto operator()(Pred pred, SinkTrue sink_true, SinkFalse sink_false) const
+    {
+        return route_fn{}(partition_key<Pred>{ std::move(pred) }, std::move(sink_true), std::move(sink_false));
+    }
+};
+
+}  // namespace detail
+
+// Sends every element to the sink selected by 'key_fn', which returns its index (an integer or an enum) in a single
+// traversal, and returns a tuple with the output iterators and the results of the pipelines. A sink is either an output
+// iterator or a terminal pipeline; pipelines read their elements on their own threads as with seq::fanout.
+// route_batched computes the keys of 'batch_size' elements at a time and then hands the batch to each sink in turn.
+static constexpr inline auto route = detail::route_fn{};
+static constexpr inline auto route_batched = detail::route_batched_fn{};
+static constexpr inline auto partition_into = detail::partition_into_fn{};
+
+}  // namespace cpp_pipelines::seq
@@ -0,0 +1,183 @@
+#pragma once
+
+#include <cpp_pipelines/iter_utils.hpp>
+#include <cpp_pipelines/pipeline.hpp>
+#include <cpp_pipelines/seq/views.hpp>
+
+namespace cpp_pipelines::seq
+{
+namespace detail
+{
+// OnlyFirst, OnlySecond, Both - which elements of the two sorted ranges are yielded
+template <bool OnlyFirst, bool OnlySecond, bool Both>
+struct set_operation_fn
+{
+    template <class Compare, class Range1, class Range2>
+    struct view
+    {
+        Compare compare;
+        Range1 range1;
+        Range2 range2;
+
+        constexpr view(Compare compare, Range1 range1, Range2 range2)
+            : compare{ std::move(compare) }
+            , range1{ std::move(range1) }
+            , range2{ std::move(range2) }
+        {
+        }
+
+        struct iter
+        {
+            enum class source
+            {
+                first,
+                second,
+                both
+            };
+
+            using iterator1 = iterator_t<Range1>;
+            using iterator2 = iterator_t<Range2>;
+            using reference = std::conditional_t<
+                std::is_same_v<iter_reference_t<iterator1>, iter_reference_t<iterator2>>,
+                iter_reference_t<iterator1>,
+                std::common_type_t<iter_value_t<iterator1>, iter_value_t<iterator2>>>;
+
+            const view* parent;
+            iterator1 it1;
+            iterator2 it2;
+            source current;
+
+            constexpr iter() = default;
+
+            constexpr iter(const view* parent, iterator1 it1, iterator2 it2)
+                : parent{ parent }
+                , it1{ it1 }
+                , it2{ it2 }
+                , current{ source::both }
+            {
+                update();
+            }
+
+            constexpr reference deref() const
+            {
+                if (current == source::second)
+                {
+                    return *it2;
+                }
+                return *it1;
+            }
+
+            constexpr void inc()
+            {
+                if (current != source::second)
+                {
+                    ++it1;
+                }
+                if (current != source::first)
+                {
+                    ++it2;
+                }
+                update();
+            }
+
+            constexpr bool is_equal(const iter& other) const
+            {
+                return it1 == other.it1 && it2 == other.it2;
+            }
+
+        private:
+            constexpr void update()
+            {
+                const auto e1 = std::end(parent->range1);
+                const auto e2 = std::end(parent->range2);
+                while (true)
+                {
+                    if (it1 == e1 || it2 == e2)
+                    {
+                        // once one of the ranges is exhausted, the rest of the other one is either yielded or skipped
+                        if (it1 != e1 && !OnlyFirst)
+                        {
+                            it1 = e1;
+                        }
+                        if (it2 != e2 && !OnlySecond)
+                        {
+                            it2 = e2;
+                        }
+                        current = it1 != e1 ? source::first : source::second;
+                        return;
+                    }
+                    if (invoke(parent->compare, *it1, *it2))
+                    {
+                        if constexpr (OnlyFirst)
+                        {
+                            current = source::first;
+                            return;
+                        }
+                        else
+                        {
+                            const auto& value = *it2;
+                            it1 = gallop_while(
+                                it1, [&](const auto& item) { return invoke(parent->compare, item, value); }, e1);
+                        }
+                    }
+                    else if (invoke(parent->compare, *it2, *it1))
+                    {
+                        if constexpr (OnlySecond)
+                        {
+                            current = source::second;
+                            return;
+                        }
+                        else
+                        {
+                            const auto& value = *it1;
+                            it2 = gallop_while(
+                                it2, [&](const auto& item) { return invoke(parent->compare, item, value); }, e2);
+                        }
+                    }
+                    else
+                    {
+                        if constexpr (Both)
+                        {
+                            current = source::both;
+                            return;
+                        }
+                        else
+                        {
+                            ++it1;
+                            ++it2;
+                        }
+                    }
+                }
+            }
+        };
+
+        using iterator = iterator_interface<iter>;
+
+        constexpr iterator begin() const
+        {
+            return { this, std::begin(range1), std::begin(range2) };
+        }
+
+        constexpr iterator end() const
+        {
+            return { this, std::end(range1), std::end(range2) };
+        }
+    };
+
+    template <class Range1, class Range2, class Compare = std::less<>>
+    constexpr auto operator()(Range1&& range1, Range2&& range2, Compare compare = {}) const
+    {
+        return view_interface{
+            view{ std::move(compare), all(std::forward<Range1>(range1)), all(std::forward<Range2>(range2)) }
+        };
+    }
+};
+
+}  // namespace detail
+
+static constexpr inline auto set_union = fn(detail::set_operation_fn<true, true, true>{});
+static constexpr inline auto set_intersection = fn(detail::set_operation_fn<false, false, true>{});
+static constexpr inline auto set_difference = fn(detail::set_operation_fn<true, false, false>{});
+static constexpr inline auto set_symmetric_difference = fn(detail::set_operation_fn<true, true, false>{});
+
+}  // namespace cpp_pipelines::seq
@@ -0,0 +1,335 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cpp_pipelines/algorithm.hpp>
+#include <cpp_pipelines/execution.hpp>
+#include <cpp_pipelines/pipeline.hpp>
+#include <cpp_pipelines/seq/views.hpp>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace cpp_pipelines::seq
+{
+namespace detail
+{
+// Stores the object representation; used by default for trivially copyable elements.
+struct binary_codec
+{
+    template <class T>
+    void write(std::ostream& os, const T& item) const
+    {
+        static_assert(std::is_trivially_copyable_v<T>, "binary_codec: trivially copyable type required, provide a codec");
+        os.write(reinterpret_cast<const char*>(std::addressof(item)), sizeof(T));
+    }
+
+    template <class T>
+    bool read(std::istream& is, T& item) const
+    {
+        return static_cast<bool>(is.read(reinterpret_cast<char*>(std::addressof(item)), sizeof(T)));
+    }
+};
+
+// A uniquely named file in 'directory', removed with the object.
+class temporary_file
+{
+public:
+    explicit temporary_file(const std::filesystem::path& directory)
+        : _path{ directory / unique_name() }
+    {
+    }
+
+    temporary_file(const temporary_file&) = delete;
+    temporary_file& operator=(const temporary_file&) = delete;
+
+    ~temporary_file()
+    {
+        std::error_code error;
+        std::filesystem::remove(_path, error);
+    }
+
+    const std::filesystem::path& path() const
+    {
+        return _path;
+    }
+
+private:
+    static std::string unique_name()
+    {
+        static const std::string prefix = []
+        {
+            std::random_device device;
+            return "cpp_pipelines-" + std::to_string(device()) + "-" + std::to_string(device()) + "-";
+        }();
+        static std::atomic<std::uint64_t> counter{ 0 };
+        return prefix + std::to_string(counter++) + ".run";
+    }
+
+    std::filesystem::path _path;
+};
+
+// Sorted runs, all but the last one spilled to files, merged with a binary heap of the runs that have elements left.
+// Ties are broken by the run index, so the merge of stably sorted runs is stable.
+template <class T, class Less, class Codec>
+class external_runs
+{
+public:
+    external_runs(Less less, Codec codec)
+        : _less{ std::move(less) }
+        , _codec{ std::move(codec) }
+        , _files{}
+        , _memory{}
+        , _memory_index{ 0 }
+        , _heap{}
+    {
+    }
+
+    void spill(const std::vector<T>& items, const std::filesystem::path& directory)
+    {
+        auto& file = _files.emplace_back(std::make_unique<file_run>(directory));
+        std::ofstream os{ file->file.path(), std::ios::binary };
+        for (const T& item : items)
+        {
+            _codec.write(os, item);
+        }
+        if (!os.flush())
+        {
+            throw std::runtime_error{ "seq::sort_external: cannot write " + file->file.path().string() };
+        }
+    }
+
+    void keep(std::vector<T> items)
+    {
+        _memory = std::move(items);
+    }
+
+    void start()
+    {
+        for (std::size_t index = 0; index < _files.size(); ++index)
+        {
+            file_run& file = *_files[index];
+            file.stream.open(file.file.path(), std::ios::binary);
+            if (!file.stream)
+            {
+                throw std::runtime_error{ "seq::sort_external: cannot read " + file.file.path().string() };
+            }
+            push(index);
+        }
+        push(_files.size());
+    }
+
+    bool empty() const
+    {
+        return _heap.empty();
+    }
+
+    const T& front() const
+    {
+        return current(_heap.front());
+    }
+
+    void pop()
+    {
+        const std::size_t index = _heap.front();
+        std::pop_heap(_heap.begin(), _heap.end(), heap_order{ this });
+        _heap.pop_back();
+        if (index == _files.size())
+        {
+            ++_memory_index;
+        }
+        push(index);
+    }
+
+private:
+    struct file_run
+    {
+        temporary_file file;
+        std::ifstream stream;
+        T current;
+
+        explicit file_run(const std::filesystem::path& directory)
+            : file{ directory }
+            , stream{}
+            , current{}
+        {
+        }
+    };
+
+    struct heap_order
+    {
+        const external_runs* self;
+
+        bool operator()(std::size_t lhs, std::size_t rhs) const
+        {
+            const T& l = self->current(lhs);
+            const T& r = self->current(rhs);
+            return self->_less(r, l) || (!self->_less(l, r) && lhs > rhs);
+        }
+    };
+
+    const T& current(std::size_t index) const
+    {
+        return index == _files.size() ? _memory[_memory_index] : _files[index]->current;
+    }
+
+    // the run's next element, if any, enters the heap
+    void push(std::size_t index)
+    {
+        if (index == _files.size() ? _memory_index == _memory.size()
+                                   : !_codec.read(_files[index]->stream, _files[index]->current))
+        {
+            return;
+        }
+        _heap.push_back(index);
+        std::push_heap(_heap.begin(), _heap.end(), heap_order{ this });
+    }
+
+    Less _less;
+    Codec _codec;
+    std::vector<std::unique_ptr<file_run>> _files;
+    std::vector<T> _memory;
+    std::size_t _memory_index;
+    std::vector<std::size_t> _heap;
+};
+
+struct sort_external_fn
+{
+    template <class Range, class Compare, class Proj, class Codec>
+    struct view
+    {
+        using value_type = range_value_t<Range>;
+        using less_type = algorithm::detail::invoke_binary<Compare, Proj, void>;
+        using runs_type = external_runs<value_type, less_type, Codec>;
+
+        Range range;
+        std::size_t memory_budget;
+        Compare compare;
+        Proj proj;
+        std::filesystem::path directory;
+        Codec codec;
+
+        // single pass: the runs are created by begin() and shared by the copies of the iterator
+        struct iter
+        {
+            using iterator_category = std::input_iterator_tag;
+            std::shared_ptr<runs_type> runs;
+
+            constexpr iter() = default;
+
+            iter(std::shared_ptr<runs_type> runs)
+                : runs{ std::move(runs) }
+            {
+            }
+
+            const value_type& deref() const
+            {
+                return runs->front();
+            }
+
+            void inc()
+            {
+                runs->pop();
+            }
+
+            bool is_equal(const iter& other) const
+            {
+                return (!runs || runs->empty()) == (!other.runs || other.runs->empty());
+            }
+        };
+
+        using iterator = iterator_interface<iter>;
+
+        iterator begin() const
+        {
+            const std::size_t run_size = std::max<std::size_t>(memory_budget / sizeof(value_type), 1);
+            auto runs = std::make_shared<runs_type>(less_type{ compare, proj }, codec);
+            std::vector<value_type> items;
+            items.reserve(run_size);
+            auto it = std::begin(range);
+            const auto last = std::end(range);
+            while (true)
+            {
+                for (; items.size() < run_size && it != last; ++it)
+                {
+                    items.push_back(*it);
+                }
+                algorithm::stable_sort(execution::par, items, std::ref(compare), std::ref(proj));
+                if (it == last)
+                {
+                    runs->keep(std::move(items));
+                    break;
+                }
+                runs->spill(items, directory);
+                items.clear();
+            }
+            runs->start();
+            return { std::move(runs) };
+        }
+
+        iterator end() const
+        {
+            return { nullptr };
+        }
+    };
+
+    template <class Compare, class Proj, class Codec>
+    struct impl
+    {
+        std::size_t memory_budget;
+        Compare compare;
+        Proj proj;
+        std::filesystem::path directory;
+        Codec codec;
+
+        template <class Range>
+        auto operator()(Range&& range) const&
+        {
+            using range_type = decltype(all(std::forward<Range>(range)));
+            return view_interface{ view<range_type, Compare, Proj, Codec>{
+                all(std::forward<Range>(range)), memory_budget, compare, proj, directory, codec } };
+        }
+
+        template <class Range>
+        auto operator()(Range&& range) &&
+        {
+            using range_type = decltype(all(std::forward<Range>(range)));
+            return view_interface{ view<range_type, Compare, Proj, Codec>{ all(std::forward<Range>(range)),
+                                                                           memory_budget,
+                                                                           std::move(compare),
+                                                                           std::move(proj),
+                                                                           std::move(directory),
+                                                                           std::move(codec) } };
+        }
+    };
+
+    template <class Compare = std::less<>, class Proj = identity_fn, class Codec = binary_codec>
+    auto operator()(
+        std::size_t memory_budget,
+        Compare compare = {},
+        Proj proj = {},
+        std::filesystem::path directory = std::filesystem::temp_directory_path(),
+        Codec codec = {}) const
+    {
+        if (memory_budget == 0)
+        {
+            throw std::invalid_argument{ "seq::sort_external: positive memory budget required" };
+        }
+        return fn(impl<Compare, Proj, Codec>{
+            memory_budget, std::move(compare), std::move(proj), std::move(directory), std::move(codec) });
+    }
+};
+
+}  // namespace detail
+
+// Sorts a range of any size: runs of at most 'memory_budget' bytes (counting sizeof of the elements) are sorted in
+// parallel and, all but the last one, written to temporary files in 'directory'. The result is a single pass view
+// merging the runs, created on begin(); the files are removed with the iterators. Elements are stored with 'codec'
+// (write(std::ostream&, const T&) and bool read(std::istream&, T&)), which defaults to their bytes. The sort is stable.
+static constexpr inline auto sort_external = detail::sort_external_fn{};
+
+}  // namespace cpp_pipelines::seq
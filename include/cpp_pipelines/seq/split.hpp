@@ -88,10 +88,16 @@ struct split_fn
         Policy policy;
 
         template <class Range>
-        constexpr auto operator()(Range&& range) const
+        constexpr auto operator()(Range&& range) const&
         {
             return view_interface{ view{ policy, all(std::forward<Range>(range)) } };
         }
+
+        template <class Range>
+        constexpr auto operator()(Range&& range) &&
+        {
+            return view_interface{ view{ std::move(policy), all(std::forward<Range>(range)) } };
+        }
     };
 
     template <class Policy>
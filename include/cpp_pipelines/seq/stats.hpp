@@ -0,0 +1,53 @@
+#pragma once
+
+#include <cpp_pipelines/pipeline.hpp>
+#include <cpp_pipelines/stats.hpp>
+#include <tuple>
+
+// Included on its own rather than through seq.hpp: the summaries of stats.hpp validate their arguments with exceptions
+// in non-template code, which would keep seq.hpp from compiling with -fno-exceptions.
+namespace cpp_pipelines::seq
+{
+namespace detail
+{
+struct stats_fn
+{
+    template <class... Summaries>
+    struct impl
+    {
+        std::tuple<Summaries...> summaries;
+
+        template <class Range>
+        auto operator()(Range&& range) const
+        {
+            auto result = summaries;
+            for (auto&& item : range)
+            {
+                std::apply([&](auto&... summary) { (summary.push(item), ...); }, result);
+            }
+            if constexpr (sizeof...(Summaries) == 1)
+            {
+                return std::get<0>(std::move(result));
+            }
+            else
+            {
+                return result;
+            }
+        }
+    };
+
+    template <class... Summaries>
+    constexpr auto operator()(Summaries... summaries) const
+    {
+        static_assert(sizeof...(Summaries) > 0, "seq::stats: at least one summary required");
+        return fn(impl<Summaries...>{ { std::move(summaries)... } });
+    }
+};
+
+}  // namespace detail
+
+// Feeds every element to each of the summaries (e.g. stats::moments, stats::quantiles) in a single traversal and
+// returns the summary, or a tuple of them.
+static constexpr inline auto stats = detail::stats_fn{};
+
+}  // namespace cpp_pipelines::seq
@@ -70,10 +70,16 @@ struct take_while_fn
         Pred pred;
 
         template <class Range>
-        constexpr auto operator()(Range&& range) const
+        constexpr auto operator()(Range&& range) const&
         {
             return view_interface{ view{ all(std::forward<Range>(range)), pred } };
         }
+
+        template <class Range>
+        constexpr auto operator()(Range&& range) &&
+        {
+            return view_interface{ view{ all(std::forward<Range>(range)), std::move(pred) } };
+        }
     };
 
     template <class Pred>
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cpp_pipelines/flat_map.hpp>
 #include <cpp_pipelines/functions.hpp>
 #include <cpp_pipelines/pipeline.hpp>
 #include <map>
@@ -17,7 +18,7 @@ struct to_map_fn
     {
         using key_type = std::decay_t<decltype(invoke(get_key, *std::begin(range)))>;
         using value_type = std::decay_t<decltype(invoke(get_value, *std::begin(range)))>;
-        return Map<key_type, value_type>{ std::forward<Range>(range) };
+        return Map<key_type, value_type>(std::begin(range), std::end(range));
     }
 };
 
@@ -32,4 +33,6 @@ static constexpr inline auto to_multimap = to_map_as<std::multimap>;
 static constexpr inline auto to_unordered_map = to_map_as<std::unordered_map>;
 static constexpr inline auto to_unordered_multimap = to_map_as<std::unordered_multimap>;
 
+static constexpr inline auto to_flat_map = to_map_as<flat_map>;
+
 }  // namespace cpp_pipelines::seq
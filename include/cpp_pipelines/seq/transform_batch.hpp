@@ -0,0 +1,178 @@
+#pragma once
+
+#include <cpp_pipelines/pipeline.hpp>
+#include <cpp_pipelines/seq/views.hpp>
+#include <cpp_pipelines/subrange.hpp>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+namespace cpp_pipelines::seq
+{
+namespace detail
+{
+// the output element type, read from the second parameter of func(const_span<In>, span<Out>)
+template <class Func>
+struct batch_output : batch_output<decltype(&Func::operator())>
+{
+};
+
+template <class R, class In, class Out>
+struct batch_output<R (*)(In, span<Out>)>
+{
+    using type = Out;
+};
+
+template <class R, class C, class In, class Out>
+struct batch_output<R (C::*)(In, span<Out>)>
+{
+    using type = Out;
+};
+
+template <class R, class C, class In, class Out>
+struct batch_output<R (C::*)(In, span<Out>) const>
+{
+    using type = Out;
+};
+
+struct transform_batch_fn
+{
+    template <class Func, class Range>
+    struct view
+    {
+        using input_type = range_value_t<Range>;
+        using output_type = typename batch_output<Func>::type;
+
+        Func func;
+        Range range;
+        std::ptrdiff_t batch_size;
+
+        constexpr view(Func func, Range range, std::ptrdiff_t batch_size)
+            : func{ std::move(func) }
+            , range{ std::move(range) }
+            , batch_size{ batch_size }
+        {
+        }
+
+        struct batch
+        {
+            std::vector<input_type> input;
+            std::vector<output_type> output;
+        };
+
+        struct iter
+        {
+            using inner_iterator = iterator_t<Range>;
+            const view* parent;
+            // 'it' is past the upstream elements of the current batch, shared by the copies of the iterator
+            inner_iterator it;
+            std::shared_ptr<batch> current;
+            std::ptrdiff_t index;
+            std::ptrdiff_t count;
+
+            constexpr iter() = default;
+
+            iter(const view* parent, inner_iterator it)
+                : parent{ parent }
+                , it{ it }
+                , current{}
+                , index{ 0 }
+                , count{ 0 }
+            {
+                refill();
+            }
+
+            output_type deref() const
+            {
+                return current->output[index];
+            }
+
+            void inc()
+            {
+                if (++index == count)
+                {
+                    refill();
+                }
+            }
+
+            bool is_equal(const iter& other) const
+            {
+                return it == other.it && count - index == other.count - other.index;
+            }
+
+        private:
+            void refill()
+            {
+                index = 0;
+                count = 0;
+                const auto end = std::end(parent->range);
+                if (it == end)
+                {
+                    return;
+                }
+                // the buffers are reused unless an earlier copy of the iterator still refers to them
+                if (!current || current.use_count() != 1)
+                {
+                    current = std::make_shared<batch>();
+                }
+                current->input.clear();
+                for (; it != end && count < parent->batch_size; ++it, ++count)
+                {
+                    current->input.push_back(*it);
+                }
+                current->output.resize(current->input.size());
+                invoke(
+                    parent->func,
+                    const_span<input_type>{ current->input.data(), current->input.data() + count },
+                    span<output_type>{ current->output.data(), current->output.data() + count });
+            }
+        };
+
+        using iterator = iterator_interface<iter>;
+
+        iterator begin() const
+        {
+            return { this, std::begin(range) };
+        }
+
+        iterator end() const
+        {
+            return { this, std::end(range) };
+        }
+    };
+
+    template <class Func>
+    struct impl
+    {
+        Func func;
+        std::ptrdiff_t batch_size;
+
+        template <class Range>
+        constexpr auto operator()(Range&& range) const&
+        {
+            return view_interface{ view{ func, all(std::forward<Range>(range)), batch_size } };
+        }
+
+        template <class Range>
+        constexpr auto operator()(Range&& range) &&
+        {
+            return view_interface{ view{ std::move(func), all(std::forward<Range>(range)), batch_size } };
+        }
+    };
+
+    template <class Func>
+    constexpr auto operator()(Func func, std::ptrdiff_t batch_size) const
+    {
+        if (batch_size <= 0)
+        {
+            throw std::invalid_argument{ "seq::transform_batch: positive batch size required" };
+        }
+        return fn(impl<Func>{ std::move(func), batch_size });
+    }
+};
+
+}  // namespace detail
+
+static constexpr inline auto transform_batch = detail::transform_batch_fn{};
+
+}  // namespace cpp_pipelines::seq
@@ -28,7 +28,10 @@ struct transform_join_fn
             inner_iterator it;
             using sub_type = std::decay_t<decltype(all(invoke(parent->func, *it)))>;
             using sub_iterator = iterator_t<sub_type>;
-            std::optional<sub_type> sub;
+            // views are default constructible unless they hold a function object that is not
+            using sub_storage
+                = std::conditional_t<std::is_default_constructible_v<sub_type>, sub_type, std::optional<sub_type>>;
+            sub_storage sub;
             sub_iterator sub_it;
 
             constexpr iter() = default;
@@ -52,7 +55,7 @@ struct transform_join_fn
 
             constexpr void inc()
             {
-                if (++sub_it == std::end(*sub))
+                if (++sub_it == std::end(sub_range()))
                 {
                     update();
                 }
@@ -69,15 +72,27 @@ struct transform_join_fn
                 return std::end(parent->range);
             }
 
+            constexpr const sub_type& sub_range() const
+            {
+                if constexpr (std::is_default_constructible_v<sub_type>)
+                {
+                    return sub;
+                }
+                else
+                {
+                    return *sub;
+                }
+            }
+
             constexpr void update_sub()
             {
                 sub = all(invoke(parent->func, *it));
-                sub_it = std::begin(*sub);
+                sub_it = std::begin(sub_range());
             }
 
             constexpr void update()
             {
-                while (it != end() && sub_it == std::end(*sub))
+                while (it != end() && sub_it == std::end(sub_range()))
                 {
                     if (++it != end())
                     {
@@ -106,10 +121,16 @@ struct transform_join_fn
         Func func;
 
         template <class Range>
-        constexpr auto operator()(Range&& range) const
+        constexpr auto operator()(Range&& range) const&
         {
             return view_interface{ view{ func, all(std::forward<Range>(range)) } };
         }
+
+        template <class Range>
+        constexpr auto operator()(Range&& range) &&
+        {
+            return view_interface{ view{ std::move(func), all(std::forward<Range>(range)) } };
+        }
     };
 
     template <class Func>
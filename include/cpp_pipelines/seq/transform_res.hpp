@@ -0,0 +1,128 @@
+#pragma once
+
+#include <cpp_pipelines/pipeline.hpp>
+#include <cpp_pipelines/res.hpp>
+#include <cpp_pipelines/seq/views.hpp>
+#include <optional>
+
+namespace cpp_pipelines::seq
+{
+namespace detail
+{
+struct transform_res_fn
+{
+    template <class Func, class Range>
+    struct view
+    {
+        Func func;
+        Range range;
+
+        constexpr view(Func func, Range range)
+            : func{ std::move(func) }
+            , range{ std::move(range) }
+        {
+        }
+
+        // single pass: the result is kept in the iterator, so a reference is only valid until it is incremented
+        struct iter
+        {
+            using iterator_category = std::input_iterator_tag;
+            using inner_iterator = iterator_t<Range>;
+            const view* parent;
+            inner_iterator it;
+            using result_type = std::decay_t<decltype(invoke(parent->func, *it))>;
+            std::optional<result_type> current;
+
+            constexpr iter() = default;
+
+            constexpr iter(const view* parent, inner_iterator it)
+                : parent{ parent }
+                , it{ it }
+                , current{}
+            {
+                update();
+            }
+
+            constexpr const result_type& deref() const
+            {
+                return *current;
+            }
+
+            // the element after an error is the end, as is the one after the end
+            constexpr void inc()
+            {
+                if (!current || current->has_error())
+                {
+                    it = std::end(parent->range);
+                }
+                else
+                {
+                    ++it;
+                }
+                update();
+            }
+
+            constexpr bool is_equal(const iter& other) const
+            {
+                return it == other.it;
+            }
+
+        private:
+            constexpr void update()
+            {
+                if (it != std::end(parent->range))
+                {
+                    current.emplace(invoke(parent->func, *it));
+                }
+                else
+                {
+                    current.reset();
+                }
+            }
+        };
+
+        using iterator = iterator_interface<iter>;
+
+        constexpr iterator begin() const
+        {
+            return { this, std::begin(range) };
+        }
+
+        constexpr iterator end() const
+        {
+            return { this, std::end(range) };
+        }
+    };
+
+    template <class Func>
+    struct impl
+    {
+        Func func;
+
+        template <class Range>
+        constexpr auto operator()(Range&& range) const&
+        {
+            return view_interface{ view{ func, all(std::forward<Range>(range)) } };
+        }
+
+        template <class Range>
+        constexpr auto operator()(Range&& range) &&
+        {
+            return view_interface{ view{ std::move(func), all(std::forward<Range>(range)) } };
+        }
+    };
+
+    template <class Func>
+    constexpr auto operator()(Func func) const
+    {
+        return fn(impl<Func>{ std::move(func) });
+    }
+};
+
+}  // namespace detail
+
+// Applies 'func', returning a result<T, E>, to the elements and yields the results up to the first error included: the
+// elements after it are not computed.
+static constexpr inline auto transform_res = detail::transform_res_fn{};
+
+}  // namespace cpp_pipelines::seq
@@ -24,11 +24,8 @@ struct owning_fn
         {
         }
 
-        constexpr view& operator=(view other)
-        {
-            std::swap(range, other.range);
-            return *this;
-        }
+        constexpr view& operator=(const view&) = default;
+        constexpr view& operator=(view&&) = default;
 
         constexpr iterator begin() const
         {
@@ -39,6 +36,12 @@ struct owning_fn
         {
             return std::end(*range);
         }
+
+        template <class R = Range, class = std::enable_if_t<is_contiguous_range<R>::value>>
+        constexpr auto data() const
+        {
+            return std::data(*range);
+        }
     };
 
     template <class Range>
@@ -66,11 +69,8 @@ struct ref_fn
         {
         }
 
-        constexpr view& operator=(view other)
-        {
-            std::swap(range, other.range);
-            return *this;
-        }
+        constexpr view& operator=(const view&) = default;
+        constexpr view& operator=(view&&) = default;
 
         constexpr iterator begin() const
         {
@@ -81,6 +81,12 @@ struct ref_fn
         {
             return std::end(*range);
         }
+
+        template <class R = Range, class = std::enable_if_t<is_contiguous_range<R>::value>>
+        constexpr auto data() const
+        {
+            return std::data(*range);
+        }
     };
 
     template <class Range>
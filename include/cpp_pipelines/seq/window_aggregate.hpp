@@ -0,0 +1,366 @@
+#pragma once
+
+#include <cpp_pipelines/pipeline.hpp>
+#include <cpp_pipelines/ring_buffer.hpp>
+#include <cpp_pipelines/seq/views.hpp>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <stdexcept>
+#include <vector>
+
+namespace cpp_pipelines::seq
+{
+namespace detail
+{
+template <class Compare>
+struct window_extremum_fn
+{
+    template <class T>
+    constexpr const T& operator()(const T& lhs, const T& rhs) const
+    {
+        return Compare{}(rhs, lhs) ? rhs : lhs;
+    }
+};
+
+struct window_mean_fn
+{
+};
+
+// Each window state supports push (the newest element enters), pop (the oldest one leaves) and result.
+
+// any associative operation: the oldest elements are kept as suffix aggregates ('front'), the newest ones with their
+// running aggregate ('back'); a pop from an empty front moves the whole back over, so every element is combined O(1)
+// times on average
+template <class T, class Op>
+struct two_stacks_window
+{
+    using result_type = std::decay_t<std::invoke_result_t<const Op&, const T&, const T&>>;
+
+    Op op;
+    std::vector<result_type> front;
+    std::vector<result_type> back;
+    std::optional<result_type> back_aggregate;
+
+    two_stacks_window(Op op, std::size_t size)
+        : op{ std::move(op) }
+        , front{}
+        , back{}
+        , back_aggregate{}
+    {
+        front.reserve(size);
+        back.reserve(size);
+    }
+
+    void push(const T& item)
+    {
+        back_aggregate = back_aggregate ? invoke(op, *back_aggregate, item) : result_type(item);
+        back.push_back(item);
+    }
+
+    void pop()
+    {
+        if (front.empty())
+        {
+            for (auto it = back.rbegin(); it != back.rend(); ++it)
+            {
+                if (front.empty())
+                {
+                    front.push_back(*it);
+                }
+                else
+                {
+                    front.push_back(invoke(op, *it, front.back()));
+                }
+            }
+            back.clear();
+            back_aggregate.reset();
+        }
+        front.pop_back();
+    }
+
+    result_type result() const
+    {
+        if (front.empty())
+        {
+            return *back_aggregate;
+        }
+        return back_aggregate ? invoke(op, front.back(), *back_aggregate) : front.back();
+    }
+};
+
+// sums are updated by adding the newest and subtracting the oldest element; floating point sums are recomputed each
+// time the window has been replaced, so that the rounding errors do not accumulate
+template <class T, bool Mean>
+struct sum_window
+{
+    using sum_type = decltype(std::declval<T>() + std::declval<T>());
+    using result_type = std::conditional_t<Mean, std::common_type_t<sum_type, double>, sum_type>;
+
+    ring_buffer<T> items;
+    sum_type sum;
+    std::size_t pops;
+
+    sum_window(std::size_t size)
+        : items{ size }
+        , sum{}
+        , pops{ 0 }
+    {
+    }
+
+    void push(const T& item)
+    {
+        items.push_back(item);
+        sum += item;
+    }
+
+    void pop()
+    {
+        sum -= items.front();
+        items.pop_front();
+        if constexpr (std::is_floating_point_v<sum_type>)
+        {
+            if (++pops == items.capacity())
+            {
+                pops = 0;
+                sum = sum_type{};
+                for (std::size_t i = 0; i < items.size(); ++i)
+                {
+                    sum += items[i];
+                }
+            }
+        }
+    }
+
+    result_type result() const
+    {
+        if constexpr (Mean)
+        {
+            return static_cast<result_type>(sum) / static_cast<result_type>(items.size());
+        }
+        else
+        {
+            return sum;
+        }
+    }
+};
+
+// minimum or maximum: a monotonic queue of the elements that can still become the extremum, with their positions
+template <class T, class Compare>
+struct extremum_window
+{
+    using result_type = T;
+
+    ring_buffer<std::pair<std::size_t, T>> candidates;
+    std::size_t first;
+    std::size_t next;
+
+    extremum_window(std::size_t size)
+        : candidates{ size }
+        , first{ 0 }
+        , next{ 0 }
+    {
+    }
+
+    void push(const T& item)
+    {
+        while (!candidates.empty() && !Compare{}(candidates.back().second, item))
+        {
+            candidates.pop_back();
+        }
+        candidates.push_back({ next++, item });
+    }
+
+    void pop()
+    {
+        if (candidates.front().first == first++)
+        {
+            candidates.pop_front();
+        }
+    }
+
+    result_type result() const
+    {
+        return candidates.front().second;
+    }
+};
+
+template <class T, class Reducer, class = void>
+struct window_state
+{
+    // the reducer stays in the view, which outlives its iterators
+    using type = two_stacks_window<T, std::reference_wrapper<const Reducer>>;
+
+    static type make(const Reducer& reducer, std::size_t size)
+    {
+        return type{ std::cref(reducer), size };
+    }
+};
+
+// a running sum for numbers; other types (e.g. strings, concatenated) go through the two stacks
+template <class T>
+struct window_state<T, std::plus<>, std::enable_if_t<std::is_arithmetic_v<T>>>
+{
+    using type = sum_window<T, false>;
+
+    static type make(const std::plus<>&, std::size_t size)
+    {
+        return type{ size };
+    }
+};
+
+template <class T>
+struct window_state<T, window_mean_fn>
+{
+    using type = sum_window<T, true>;
+
+    static type make(const window_mean_fn&, std::size_t size)
+    {
+        return type{ size };
+    }
+};
+
+template <class T, class Compare>
+struct window_state<T, window_extremum_fn<Compare>>
+{
+    using type = extremum_window<T, Compare>;
+
+    static type make(const window_extremum_fn<Compare>&, std::size_t size)
+    {
+        return type{ size };
+    }
+};
+
+struct window_aggregate_fn
+{
+    template <class Reducer, class Range>
+    struct view
+    {
+        using state_factory = window_state<range_value_t<Range>, Reducer>;
+        using state_type = typename state_factory::type;
+
+        Reducer reducer;
+        Range range;
+        std::size_t size;
+
+        constexpr view(Reducer reducer, Range range, std::size_t size)
+            : reducer{ std::move(reducer) }
+            , range{ std::move(range) }
+            , size{ size }
+        {
+        }
+
+        // single pass: the window state is shared by the copies of the iterator
+        struct iter
+        {
+            using iterator_category = std::input_iterator_tag;
+            using inner_iterator = iterator_t<Range>;
+            const view* parent;
+            inner_iterator it;
+            std::shared_ptr<state_type> state;
+
+            constexpr iter() = default;
+
+            iter(const view* parent, inner_iterator it)
+                : parent{ parent }
+                , it{ it }
+                , state{}
+            {
+            }
+
+            static iter first(const view* parent)
+            {
+                iter result{ parent, std::begin(parent->range) };
+                const auto end = std::end(parent->range);
+                result.state = std::make_shared<state_type>(state_factory::make(parent->reducer, parent->size));
+                std::size_t count = 0;
+                for (; count < parent->size && result.it != end; ++count, ++result.it)
+                {
+                    result.state->push(*result.it);
+                }
+                if (count < parent->size)
+                {
+                    result.state.reset();
+                }
+                return result;
+            }
+
+            typename state_type::result_type deref() const
+            {
+                return state->result();
+            }
+
+            void inc()
+            {
+                if (it == std::end(parent->range))
+                {
+                    state.reset();
+                    return;
+                }
+                state->pop();
+                state->push(*it);
+                ++it;
+            }
+
+            bool is_equal(const iter& other) const
+            {
+                return !state == !other.state && (!state || it == other.it);
+            }
+        };
+
+        using iterator = iterator_interface<iter>;
+
+        iterator begin() const
+        {
+            return { iter::first(this) };
+        }
+
+        iterator end() const
+        {
+            return { this, std::end(range) };
+        }
+    };
+
+    template <class Reducer>
+    struct impl
+    {
+        std::size_t size;
+        Reducer reducer;
+
+        template <class Range>
+        constexpr auto operator()(Range&& range) const&
+        {
+            return view_interface{ view{ reducer, all(std::forward<Range>(range)), size } };
+        }
+
+        template <class Range>
+        constexpr auto operator()(Range&& range) &&
+        {
+            return view_interface{ view{ std::move(reducer), all(std::forward<Range>(range)), size } };
+        }
+    };
+
+    template <class Reducer>
+    constexpr auto operator()(std::size_t size, Reducer reducer) const
+    {
+        if (size == 0)
+        {
+            throw std::invalid_argument{ "seq::window_aggregate: positive size required" };
+        }
+        return fn(impl<Reducer>{ size, std::move(reducer) });
+    }
+};
+
+}  // namespace detail
+
+// Aggregate of every full window of 'size' consecutive elements, updated incrementally: add and subtract for
+// window_sum and window_mean, a monotonic queue for window_min and window_max, and two stacks for any other associative
+// operation.
+static constexpr inline auto window_aggregate = detail::window_aggregate_fn{};
+
+static constexpr inline auto window_sum = std::plus<>{};
+static constexpr inline auto window_mean = detail::window_mean_fn{};
+static constexpr inline auto window_min = detail::window_extremum_fn<std::less<>>{};
+static constexpr inline auto window_max = detail::window_extremum_fn<std::greater<>>{};
+
+}  // namespace cpp_pipelines::seq
@@ -7,6 +7,38 @@ namespace cpp_pipelines::seq
 {
 namespace detail
 {
+template <std::size_t I, class Iter>
+struct iterator_tuple_leaf
+{
+    Iter it;
+};
+
+template <class Indices, class... Iters>
+struct iterator_tuple_base;
+
+template <std::size_t... I, class... Iters>
+struct iterator_tuple_base<std::index_sequence<I...>, Iters...> : iterator_tuple_leaf<I, Iters>...
+{
+};
+
+// std::tuple has user-provided assignment operators; this aggregate is trivially copyable whenever the iterators are
+template <class... Iters>
+struct iterator_tuple : iterator_tuple_base<std::index_sequence_for<Iters...>, Iters...>
+{
+};
+
+template <std::size_t I, class Iter>
+constexpr Iter& get_iterator(iterator_tuple_leaf<I, Iter>& leaf)
+{
+    return leaf.it;
+}
+
+template <std::size_t I, class Iter>
+constexpr const Iter& get_iterator(const iterator_tuple_leaf<I, Iter>& leaf)
+{
+    return leaf.it;
+}
+
 struct zip_transform_fn
 {
     template <class Func, class... Ranges>
@@ -25,11 +57,11 @@ struct zip_transform_fn
         struct iter
         {
             const view* parent;
-            std::tuple<iterator_t<Ranges>...> its;
+            iterator_tuple<iterator_t<Ranges>...> its;
 
             constexpr iter() = default;
 
-            constexpr iter(const view* parent, std::tuple<iterator_t<Ranges>...> its)
+            constexpr iter(const view* parent, iterator_tuple<iterator_t<Ranges>...> its)
                 : parent{ parent }
                 , its{ its }
             {
@@ -54,19 +86,19 @@ struct zip_transform_fn
             template <std::size_t... I>
             constexpr decltype(auto) call(std::index_sequence<I...>) const
             {
-                return invoke(parent->func, *std::get<I>(its)...);
+                return invoke(parent->func, *get_iterator<I>(its)...);
             }
 
             template <std::size_t... I>
             constexpr void inc(std::index_sequence<I...>)
             {
-                (..., ++std::get<I>(its));
+                (..., ++get_iterator<I>(its));
             }
 
             template <std::size_t... I>
             bool is_equal(const iter& other, std::index_sequence<I...>) const
             {
-                return (... || (std::get<I>(its) == std::get<I>(other.its)));
+                return (... || (get_iterator<I>(its) == get_iterator<I>(other.its)));
             }
         };
 
@@ -86,13 +118,13 @@ struct zip_transform_fn
         template <std::size_t... I>
         constexpr iterator begin(std::index_sequence<I...>) const
         {
-            return { this, std::tuple{ std::begin(std::get<I>(ranges))... } };
+            return { this, iterator_tuple<iterator_t<Ranges>...>{ { { std::begin(std::get<I>(ranges)) }... } } };
         }
 
         template <std::size_t... I>
         constexpr iterator end(std::index_sequence<I...>) const
         {
-            return { this, std::tuple{ std::end(std::get<I>(ranges))... } };
+            return { this, iterator_tuple<iterator_t<Ranges>...>{ { { std::end(std::get<I>(ranges)) }... } } };
         }
     };
 
@@ -102,10 +134,16 @@ struct zip_transform_fn
         Func func;
 
         template <class... Ranges>
-        constexpr auto operator()(Ranges&&... ranges) const
+        constexpr auto operator()(Ranges&&... ranges) const&
         {
             return view_interface{ view{ func, std::tuple{ all(std::forward<Ranges>(ranges))... } } };
         }
+
+        template <class... Ranges>
+        constexpr auto operator()(Ranges&&... ranges) &&
+        {
+            return view_interface{ view{ std::move(func), std::tuple{ all(std::forward<Ranges>(ranges))... } } };
+        }
     };
 
     template <class Func>
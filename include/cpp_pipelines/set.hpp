@@ -1,11 +1,32 @@
 #pragma once
 
 #include <cpp_pipelines/algorithm.hpp>
+#include <cpp_pipelines/flat_set.hpp>
+#include <cpp_pipelines/simd/set_intersection.hpp>
 #include <set>
 #include <unordered_set>
 
 namespace cpp_pipelines::set
 {
+namespace detail
+{
+template <class Set>
+using insert_result_t = decltype(std::declval<Set&>().insert(std::declval<typename Set::value_type>()));
+
+template <class Set>
+static constexpr bool has_unique_keys
+    = std::is_same_v<insert_result_t<Set>, std::pair<typename Set::iterator, bool>>;
+
+// the block-wise kernel may report a duplicated input value twice, which a set with unique keys absorbs
+template <class Set, class L, class R>
+static constexpr bool use_simd_intersection = is_contiguous_range<L>::value && is_contiguous_range<R>::value
+                                              && std::is_same_v<range_value_t<L>, typename Set::value_type>
+                                              && std::is_same_v<range_value_t<R>, typename Set::value_type>
+                                              && simd::is_intersectable<typename Set::value_type>::value
+                                              && has_unique_keys<Set>;
+
+}  // namespace detail
+
 template <class L, class R>
 bool includes(L&& lhs, R&& rhs)
 {
@@ -35,7 +56,18 @@ auto intersection(L&& lhs, R&& rhs)
 {
     using T = std::common_type_t<range_value_t<L>, range_value_t<R>>;
     Set<T> result;
-    algorithm::set_intersection(std::forward<L>(lhs), std::forward<R>(rhs), std::inserter(result, result.end()));
+    if constexpr (detail::use_simd_intersection<Set<T>, L, R>)
+    {
+        const auto l = as_span(lhs);
+        const auto r = as_span(rhs);
+        std::vector<T> buffer(l.size());
+        const auto end = simd::set_intersection(l.begin(), l.end(), r.begin(), r.end(), buffer.data());
+        std::copy(buffer.data(), end, std::inserter(result, result.end()));
+    }
+    else
+    {
+        algorithm::set_intersection(std::forward<L>(lhs), std::forward<R>(rhs), std::inserter(result, result.end()));
+    }
     return result;
 }
 
@@ -0,0 +1,121 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cpp_pipelines/simd/reduce.hpp>
+#include <cstddef>
+#include <cstdint>
+
+namespace cpp_pipelines::simd
+{
+namespace detail
+{
+template <class T, class Pred>
+T* compress_tail(const T* b, const T* e, T* out, const Pred& pred)
+{
+    for (; b != e; ++b)
+    {
+        *out = *b;
+        out += pred(*b) ? 1 : 0;
+    }
+    return out;
+}
+
+#if defined(__GNUC__)
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wpsabi"
+
+// every lane is stored, the output only advances past the selected ones
+template <std::size_t Bytes, class T, class Pred>
+T* compress_kernel(const T* b, const T* e, T* out, const Pred& pred)
+{
+    using V = typename vec<T, Bytes>::type;
+    constexpr std::size_t lanes = Bytes / sizeof(T);
+    for (; static_cast<std::size_t>(e - b) >= lanes; b += lanes)
+    {
+        const V values = load<Bytes>(b);
+        decltype(values < values) mask;
+        pred.mask(values, mask);
+        for (std::size_t i = 0; i < lanes; ++i)
+        {
+            *out = values[i];
+            out -= mask[i];
+        }
+    }
+    return compress_tail(b, e, out, pred);
+}
+
+#if CPP_PIPELINES_SIMD_X86
+
+// for each mask of selected lanes, the 32 bit slots that move the selected lanes to the front, one per byte
+template <std::size_t Lanes>
+constexpr std::array<std::uint64_t, (1u << Lanes)> make_compress_table()
+{
+    constexpr std::size_t slots = 8 / Lanes;
+    std::array<std::uint64_t, (1u << Lanes)> result{};
+    for (std::size_t mask = 0; mask < result.size(); ++mask)
+    {
+        std::size_t position = 0;
+        for (std::size_t lane = 0; lane < Lanes; ++lane)
+        {
+            if (mask & (1u << lane))
+            {
+                for (std::size_t slot = 0; slot < slots; ++slot, ++position)
+                {
+                    result[mask] |= std::uint64_t{ lane * slots + slot } << (8 * position);
+                }
+            }
+        }
+    }
+    return result;
+}
+
+template <std::size_t Lanes>
+static constexpr inline auto compress_table = make_compress_table<Lanes>();
+
+template <class T, class Pred>
+CPP_PIPELINES_TARGET("avx2,popcnt")
+T* compress_avx2(const T* b, const T* e, T* out, const Pred& pred)
+{
+    using V = typename vec<T, 32>::type;
+    constexpr std::size_t lanes = 32 / sizeof(T);
+    for (; static_cast<std::size_t>(e - b) >= lanes; b += lanes)
+    {
+        const V values = load<32>(b);
+        decltype(values < values) selected;
+        pred.mask(values, selected);
+        const int mask = sizeof(T) == 4 ? _mm256_movemask_ps((__m256)selected) : _mm256_movemask_pd((__m256d)selected);
+        const __m256i permutation
+            = _mm256_cvtepu8_epi32(_mm_cvtsi64_si128(static_cast<long long>(compress_table<lanes>[mask])));
+        _mm256_storeu_si256(
+            reinterpret_cast<__m256i*>(out), _mm256_permutevar8x32_epi32((__m256i)values, permutation));
+        out += __builtin_popcount(mask);
+    }
+    return compress_tail(b, e, out, pred);
+}
+
+#endif
+
+#pragma GCC diagnostic pop
+
+#endif
+
+}  // namespace detail
+
+// Copies the elements for which pred holds to out and returns the end of the copy. Whole blocks of elements are
+// stored at once, so out must have room for (e - b) elements, whatever the number of selected ones.
+template <class T, class Pred>
+T* compress(const T* b, const T* e, T* out, Pred pred)
+{
+    static_assert(sizeof(T) == 4 || sizeof(T) == 8, "simd::compress: 32 or 64 bit type required");
+#if CPP_PIPELINES_SIMD_X86
+    return has_avx2() ? detail::compress_avx2(b, e, out, pred) : detail::compress_kernel<16>(b, e, out, pred);
+#elif defined(__GNUC__)
+    return detail::compress_kernel<16>(b, e, out, pred);
+#else
+    return detail::compress_tail(b, e, out, pred);
+#endif
+}
+
+}  // namespace cpp_pipelines::simd
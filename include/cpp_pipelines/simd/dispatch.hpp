@@ -0,0 +1,25 @@
+#pragma once
+
+#if defined(__x86_64__) && defined(__GNUC__) && !defined(CPP_PIPELINES_NO_SIMD)
+#define CPP_PIPELINES_SIMD_X86 1
+#define CPP_PIPELINES_TARGET(arch) __attribute__((target(arch)))
+#include <immintrin.h>
+#else
+#define CPP_PIPELINES_SIMD_X86 0
+#define CPP_PIPELINES_TARGET(arch)
+#endif
+
+namespace cpp_pipelines::simd
+{
+// SSE2 is part of the x86-64 baseline, wider instruction sets are detected at runtime
+inline bool has_avx2()
+{
+#if CPP_PIPELINES_SIMD_X86
+    static const bool result = __builtin_cpu_supports("avx2");
+    return result;
+#else
+    return false;
+#endif
+}
+
+}  // namespace cpp_pipelines::simd
@@ -0,0 +1,72 @@
+#pragma once
+
+#include <functional>
+#include <type_traits>
+
+namespace cpp_pipelines::simd
+{
+// Predicates understood by the kernels: called with an element they yield a bool, and mask(values, result) sets all
+// the bits of the lanes of result where the predicate holds for the vector of elements.
+
+// compare(element, value), compare being one of the std comparison function objects
+template <class Compare, class T>
+struct compare_with
+{
+    T value;
+
+    constexpr bool operator()(T item) const
+    {
+        return Compare{}(item, value);
+    }
+
+    template <class V, class M>
+    void mask(const V& values, M& result) const
+    {
+        if constexpr (std::is_same_v<Compare, std::equal_to<>>)
+        {
+            result = values == value;
+        }
+        else if constexpr (std::is_same_v<Compare, std::not_equal_to<>>)
+        {
+            result = values != value;
+        }
+        else if constexpr (std::is_same_v<Compare, std::less<>>)
+        {
+            result = values < value;
+        }
+        else if constexpr (std::is_same_v<Compare, std::less_equal<>>)
+        {
+            result = values <= value;
+        }
+        else if constexpr (std::is_same_v<Compare, std::greater<>>)
+        {
+            result = values > value;
+        }
+        else
+        {
+            static_assert(std::is_same_v<Compare, std::greater_equal<>>, "simd::compare_with: comparison required");
+            result = values >= value;
+        }
+    }
+};
+
+// low <= element <= high
+template <class T>
+struct between
+{
+    T low;
+    T high;
+
+    constexpr bool operator()(T item) const
+    {
+        return low <= item && item <= high;
+    }
+
+    template <class V, class M>
+    void mask(const V& values, M& result) const
+    {
+        result = (values >= low) & (values <= high);
+    }
+};
+
+}  // namespace cpp_pipelines::simd
@@ -0,0 +1,360 @@
+#pragma once
+
+#include <algorithm>
+#include <cpp_pipelines/simd/dispatch.hpp>
+#include <cpp_pipelines/simd/predicates.hpp>
+#include <cstddef>
+#include <cstring>
+#include <functional>
+#include <type_traits>
+
+namespace cpp_pipelines::simd
+{
+template <class T>
+struct is_vectorizable
+    : std::bool_constant<
+          std::is_arithmetic_v<T> && !std::is_same_v<T, bool>
+          && (sizeof(T) == 1 || sizeof(T) == 2 || sizeof(T) == 4 || sizeof(T) == 8)>
+{
+};
+
+namespace detail
+{
+#if defined(__GNUC__)
+
+// the 32 byte vectors only cross the boundaries of functions inlined into the AVX2 entry points
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wpsabi"
+
+#define CPP_PIPELINES_ALWAYS_INLINE inline __attribute__((always_inline))
+
+template <class T, std::size_t Bytes>
+struct vec
+{
+    typedef T type __attribute__((vector_size(Bytes)));
+};
+
+template <std::size_t Bytes, class T>
+CPP_PIPELINES_ALWAYS_INLINE typename vec<T, Bytes>::type load(const T* ptr)
+{
+    typename vec<T, Bytes>::type result;
+    std::memcpy(&result, ptr, Bytes);
+    return result;
+}
+
+template <std::size_t Bytes, class T>
+CPP_PIPELINES_ALWAYS_INLINE typename vec<T, Bytes>::type splat(T value)
+{
+    typename vec<T, Bytes>::type result;
+    for (std::size_t i = 0; i < Bytes / sizeof(T); ++i)
+    {
+        result[i] = value;
+    }
+    return result;
+}
+
+// Four independent vector accumulators hide the latency of the loop-carried dependency; 'step' folds a block into an
+// accumulator, 'finish' combines the accumulators and the tail. Vectors are passed by reference only, as passing them
+// by value to functions compiled without AVX is an ABI hazard.
+template <std::size_t Bytes, class T, class Acc, class Step, class Finish>
+CPP_PIPELINES_ALWAYS_INLINE auto blocks(const T* b, const T* e, const Acc& init, Step step, Finish finish)
+{
+    constexpr std::size_t lanes = Bytes / sizeof(T);
+    Acc acc[4] = { init, init, init, init };
+    for (; static_cast<std::size_t>(e - b) >= 4 * lanes; b += 4 * lanes)
+    {
+        for (std::size_t k = 0; k < 4; ++k)
+        {
+            step(acc[k], b + k * lanes);
+        }
+    }
+    for (; static_cast<std::size_t>(e - b) >= lanes; b += lanes)
+    {
+        step(acc[0], b);
+    }
+    return finish(acc, b, e);
+}
+
+template <std::size_t Bytes, class T>
+CPP_PIPELINES_ALWAYS_INLINE T sum_kernel(const T* b, const T* e)
+{
+    using V = typename vec<T, Bytes>::type;
+    return blocks<Bytes>(
+        b,
+        e,
+        V{},
+        [](V& acc, const T* p) { acc += load<Bytes>(p); },
+        [](const V (&acc)[4], const T* tail, const T* end)
+        {
+            const V total = (acc[0] + acc[1]) + (acc[2] + acc[3]);
+            T result{};
+            for (std::size_t i = 0; i < Bytes / sizeof(T); ++i)
+            {
+                result += total[i];
+            }
+            for (; tail != end; ++tail)
+            {
+                result += *tail;
+            }
+            return result;
+        });
+}
+
+template <std::size_t Bytes, bool Max, class T>
+CPP_PIPELINES_ALWAYS_INLINE T extremum_kernel(const T* b, const T* e)
+{
+    using V = typename vec<T, Bytes>::type;
+    return blocks<Bytes>(
+        b,
+        e,
+        splat<Bytes>(*b),
+        [](V& acc, const T* p)
+        {
+            const V values = load<Bytes>(p);
+            acc = Max ? (acc < values ? values : acc) : (values < acc ? values : acc);
+        },
+        [](const V (&acc)[4], const T* tail, const T* end)
+        {
+            const auto select = [](T lhs, T rhs) { return Max ? (lhs < rhs ? rhs : lhs) : (rhs < lhs ? rhs : lhs); };
+            T result = acc[0][0];
+            for (std::size_t k = 0; k < 4; ++k)
+            {
+                for (std::size_t i = 0; i < Bytes / sizeof(T); ++i)
+                {
+                    result = select(result, acc[k][i]);
+                }
+            }
+            for (; tail != end; ++tail)
+            {
+                result = select(result, *tail);
+            }
+            return result;
+        });
+}
+
+template <std::size_t Bytes, class T>
+CPP_PIPELINES_ALWAYS_INLINE T dot_kernel(const T* a, const T* a_end, const T* b)
+{
+    using V = typename vec<T, Bytes>::type;
+    const std::ptrdiff_t offset = b - a;
+    return blocks<Bytes>(
+        a,
+        a_end,
+        V{},
+        [=](V& acc, const T* p) { acc += load<Bytes>(p) * load<Bytes>(p + offset); },
+        [=](const V (&acc)[4], const T* tail, const T* end)
+        {
+            const V total = (acc[0] + acc[1]) + (acc[2] + acc[3]);
+            T result{};
+            for (std::size_t i = 0; i < Bytes / sizeof(T); ++i)
+            {
+                result += total[i];
+            }
+            for (; tail != end; ++tail)
+            {
+                result += *tail * tail[offset];
+            }
+            return result;
+        });
+}
+
+// masks have lanes of -1 (true) or 0 (false), which are subtracted from the lane counters
+template <std::size_t Bytes, class T, class Pred>
+CPP_PIPELINES_ALWAYS_INLINE std::ptrdiff_t count_kernel(const T* b, const T* e, const Pred& pred)
+{
+    using V = typename vec<T, Bytes>::type;
+    using M = decltype(std::declval<V>() < std::declval<V>());
+    return blocks<Bytes>(
+        b,
+        e,
+        M{},
+        [&](M& acc, const T* p)
+        {
+            M mask;
+            pred.mask(load<Bytes>(p), mask);
+            acc -= mask;
+        },
+        [&](const M (&acc)[4], const T* tail, const T* end)
+        {
+            const M total = (acc[0] + acc[1]) + (acc[2] + acc[3]);
+            std::ptrdiff_t result = 0;
+            for (std::size_t i = 0; i < Bytes / sizeof(T); ++i)
+            {
+                result += total[i];
+            }
+            for (; tail != end; ++tail)
+            {
+                result += pred(*tail) ? 1 : 0;
+            }
+            return result;
+        });
+}
+
+// scalar accumulators only, so that 'op' can be anything; the compiler vectorizes them when 'op' allows it
+template <std::size_t Count, class T, class Acc, class UnaryFunc>
+CPP_PIPELINES_ALWAYS_INLINE Acc transform_sum_kernel(const T* b, const T* e, Acc init, UnaryFunc& op)
+{
+    Acc acc[Count] = {};
+    for (; static_cast<std::size_t>(e - b) >= Count; b += Count)
+    {
+        for (std::size_t k = 0; k < Count; ++k)
+        {
+            acc[k] += static_cast<Acc>(op(b[k]));
+        }
+    }
+    for (; b != e; ++b)
+    {
+        init += static_cast<Acc>(op(*b));
+    }
+    for (std::size_t k = 0; k < Count; ++k)
+    {
+        init += acc[k];
+    }
+    return init;
+}
+
+#undef CPP_PIPELINES_ALWAYS_INLINE
+
+#if CPP_PIPELINES_SIMD_X86
+
+template <class T>
+CPP_PIPELINES_TARGET("avx2")
+T sum_avx2(const T* b, const T* e)
+{
+    return sum_kernel<32>(b, e);
+}
+
+template <bool Max, class T>
+CPP_PIPELINES_TARGET("avx2")
+T extremum_avx2(const T* b, const T* e)
+{
+    return extremum_kernel<32, Max>(b, e);
+}
+
+template <class T>
+CPP_PIPELINES_TARGET("avx2")
+T dot_avx2(const T* a, const T* a_end, const T* b)
+{
+    return dot_kernel<32>(a, a_end, b);
+}
+
+template <class T, class Pred>
+CPP_PIPELINES_TARGET("avx2")
+std::ptrdiff_t count_avx2(const T* b, const T* e, const Pred& pred)
+{
+    return count_kernel<32>(b, e, pred);
+}
+
+template <class T, class Acc, class UnaryFunc>
+CPP_PIPELINES_TARGET("avx2")
+Acc transform_sum_avx2(const T* b, const T* e, Acc init, UnaryFunc& op)
+{
+    return transform_sum_kernel<64 / sizeof(Acc)>(b, e, init, op);
+}
+
+#endif
+
+#pragma GCC diagnostic pop
+
+#endif
+
+}  // namespace detail
+
+// Sum of the elements; the additions are reassociated, which changes the rounding of floating point sums.
+template <class T>
+T sum(const T* b, const T* e)
+{
+    static_assert(is_vectorizable<T>::value, "simd::sum: arithmetic type required");
+#if CPP_PIPELINES_SIMD_X86
+    return has_avx2() ? detail::sum_avx2(b, e) : detail::sum_kernel<16>(b, e);
+#elif defined(__GNUC__)
+    return detail::sum_kernel<16>(b, e);
+#else
+    T result{};
+    for (; b != e; ++b)
+    {
+        result += *b;
+    }
+    return result;
+#endif
+}
+
+// Smallest and largest element of a non-empty array.
+template <class T>
+T min(const T* b, const T* e)
+{
+    static_assert(is_vectorizable<T>::value, "simd::min: arithmetic type required");
+#if CPP_PIPELINES_SIMD_X86
+    return has_avx2() ? detail::extremum_avx2<false>(b, e) : detail::extremum_kernel<16, false>(b, e);
+#elif defined(__GNUC__)
+    return detail::extremum_kernel<16, false>(b, e);
+#else
+    return *std::min_element(b, e);
+#endif
+}
+
+template <class T>
+T max(const T* b, const T* e)
+{
+    static_assert(is_vectorizable<T>::value, "simd::max: arithmetic type required");
+#if CPP_PIPELINES_SIMD_X86
+    return has_avx2() ? detail::extremum_avx2<true>(b, e) : detail::extremum_kernel<16, true>(b, e);
+#elif defined(__GNUC__)
+    return detail::extremum_kernel<16, true>(b, e);
+#else
+    return *std::max_element(b, e);
+#endif
+}
+
+// Sum of a[i] * b[i] for the elements of [a, a_end).
+template <class T>
+T dot(const T* a, const T* a_end, const T* b)
+{
+    static_assert(is_vectorizable<T>::value, "simd::dot: arithmetic type required");
+#if CPP_PIPELINES_SIMD_X86
+    return has_avx2() ? detail::dot_avx2(a, a_end, b) : detail::dot_kernel<16>(a, a_end, b);
+#elif defined(__GNUC__)
+    return detail::dot_kernel<16>(a, a_end, b);
+#else
+    T result{};
+    for (; a != a_end; ++a, ++b)
+    {
+        result += *a * *b;
+    }
+    return result;
+#endif
+}
+
+// Number of elements for which pred holds; pred is one of the predicates of simd/predicates.hpp.
+template <class T, class Pred>
+std::ptrdiff_t count(const T* b, const T* e, Pred pred)
+{
+    static_assert(sizeof(T) == 4 || sizeof(T) == 8, "simd::count: 32 or 64 bit type required");
+#if CPP_PIPELINES_SIMD_X86
+    return has_avx2() ? detail::count_avx2(b, e, pred) : detail::count_kernel<16>(b, e, pred);
+#elif defined(__GNUC__)
+    return detail::count_kernel<16>(b, e, pred);
+#else
+    return std::count_if(b, e, pred);
+#endif
+}
+
+// init + the sum of op(element), with the additions spread over several accumulators.
+template <class T, class Acc, class UnaryFunc>
+Acc transform_sum(const T* b, const T* e, Acc init, UnaryFunc op)
+{
+#if CPP_PIPELINES_SIMD_X86
+    return has_avx2() ? detail::transform_sum_avx2(b, e, init, op)
+                      : detail::transform_sum_kernel<32 / sizeof(Acc)>(b, e, init, op);
+#elif defined(__GNUC__)
+    return detail::transform_sum_kernel<32 / sizeof(Acc)>(b, e, init, op);
+#else
+    for (; b != e; ++b)
+    {
+        init += static_cast<Acc>(op(*b));
+    }
+    return init;
+#endif
+}
+
+}  // namespace cpp_pipelines::simd
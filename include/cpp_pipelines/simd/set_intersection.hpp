@@ -0,0 +1,207 @@
+#pragma once
+
+#include <cpp_pipelines/iter_utils.hpp>
+#include <cpp_pipelines/simd/dispatch.hpp>
+#include <cstdint>
+#include <type_traits>
+
+namespace cpp_pipelines::simd
+{
+namespace detail
+{
+template <class T>
+T* intersect_scalar(const T* a, const T* a_end, const T* b, const T* b_end, T* out)
+{
+    while (a != a_end && b != b_end)
+    {
+        if (*a < *b)
+        {
+            ++a;
+        }
+        else if (*b < *a)
+        {
+            ++b;
+        }
+        else
+        {
+            *out++ = *a;
+            ++a;
+            ++b;
+        }
+    }
+    return out;
+}
+
+template <class T>
+T* intersect_galloping(const T* small, const T* small_end, const T* large, const T* large_end, T* out)
+{
+    for (; small != small_end && large != large_end; ++small)
+    {
+        const auto value = *small;
+        large = gallop_while(large, [=](T item) { return item < value; }, large_end);
+        if (large != large_end && *large == value)
+        {
+            *out++ = value;
+            ++large;
+        }
+    }
+    return out;
+}
+
+#if CPP_PIPELINES_SIMD_X86
+
+template <class T>
+T* emit_matches(const T* a, int mask, T* out)
+{
+    while (mask != 0)
+    {
+        *out++ = a[__builtin_ctz(mask)];
+        mask &= mask - 1;
+    }
+    return out;
+}
+
+// values of 'a' up to the last one already written cannot match the rest of 'b'
+template <class T>
+const T* skip_emitted(const T* a, int emitted)
+{
+    return emitted != 0 ? a + (32 - __builtin_clz(static_cast<unsigned>(emitted))) : a;
+}
+
+// each block of 'a' is compared against all rotations of a block of 'b', then the block with the smaller
+// last element is advanced (both on a tie); 'emitted' keeps a block of 'a' from being written twice
+
+template <class T>
+T* intersect_sse2_32(const T* a, const T* a_end, const T* b, const T* b_end, T* out)
+{
+    int emitted = 0;
+    while (a_end - a >= 4 && b_end - b >= 4)
+    {
+        const __m128i va = _mm_loadu_si128(reinterpret_cast<const __m128i*>(a));
+        const __m128i vb = _mm_loadu_si128(reinterpret_cast<const __m128i*>(b));
+        __m128i eq = _mm_cmpeq_epi32(va, vb);
+        eq = _mm_or_si128(eq, _mm_cmpeq_epi32(va, _mm_shuffle_epi32(vb, _MM_SHUFFLE(0, 3, 2, 1))));
+        eq = _mm_or_si128(eq, _mm_cmpeq_epi32(va, _mm_shuffle_epi32(vb, _MM_SHUFFLE(1, 0, 3, 2))));
+        eq = _mm_or_si128(eq, _mm_cmpeq_epi32(va, _mm_shuffle_epi32(vb, _MM_SHUFFLE(2, 1, 0, 3))));
+        const int mask = _mm_movemask_ps(_mm_castsi128_ps(eq)) & ~emitted;
+        out = emit_matches(a, mask, out);
+        emitted |= mask;
+
+        const T a_max = a[3];
+        const T b_max = b[3];
+        if (a_max <= b_max)
+        {
+            a += 4;
+            emitted = 0;
+        }
+        b += b_max <= a_max ? 4 : 0;
+    }
+    return intersect_scalar(skip_emitted(a, emitted), a_end, b, b_end, out);
+}
+
+template <class T>
+CPP_PIPELINES_TARGET("avx2")
+T* intersect_avx2_32(const T* a, const T* a_end, const T* b, const T* b_end, T* out)
+{
+    const __m256i rotate = _mm256_setr_epi32(1, 2, 3, 4, 5, 6, 7, 0);
+    int emitted = 0;
+    while (a_end - a >= 8 && b_end - b >= 8)
+    {
+        const __m256i va = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a));
+        __m256i vb = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(b));
+        __m256i eq = _mm256_cmpeq_epi32(va, vb);
+        for (int i = 1; i < 8; ++i)
+        {
+            vb = _mm256_permutevar8x32_epi32(vb, rotate);
+            eq = _mm256_or_si256(eq, _mm256_cmpeq_epi32(va, vb));
+        }
+        const int mask = _mm256_movemask_ps(_mm256_castsi256_ps(eq)) & ~emitted;
+        out = emit_matches(a, mask, out);
+        emitted |= mask;
+
+        const T a_max = a[7];
+        const T b_max = b[7];
+        if (a_max <= b_max)
+        {
+            a += 8;
+            emitted = 0;
+        }
+        b += b_max <= a_max ? 8 : 0;
+    }
+    return intersect_scalar(skip_emitted(a, emitted), a_end, b, b_end, out);
+}
+
+template <class T>
+CPP_PIPELINES_TARGET("avx2")
+T* intersect_avx2_64(const T* a, const T* a_end, const T* b, const T* b_end, T* out)
+{
+    int emitted = 0;
+    while (a_end - a >= 4 && b_end - b >= 4)
+    {
+        const __m256i va = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a));
+        const __m256i vb = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(b));
+        __m256i eq = _mm256_cmpeq_epi64(va, vb);
+        eq = _mm256_or_si256(eq, _mm256_cmpeq_epi64(va, _mm256_permute4x64_epi64(vb, _MM_SHUFFLE(0, 3, 2, 1))));
+        eq = _mm256_or_si256(eq, _mm256_cmpeq_epi64(va, _mm256_permute4x64_epi64(vb, _MM_SHUFFLE(1, 0, 3, 2))));
+        eq = _mm256_or_si256(eq, _mm256_cmpeq_epi64(va, _mm256_permute4x64_epi64(vb, _MM_SHUFFLE(2, 1, 0, 3))));
+        const int mask = _mm256_movemask_pd(_mm256_castsi256_pd(eq)) & ~emitted;
+        out = emit_matches(a, mask, out);
+        emitted |= mask;
+
+        const T a_max = a[3];
+        const T b_max = b[3];
+        if (a_max <= b_max)
+        {
+            a += 4;
+            emitted = 0;
+        }
+        b += b_max <= a_max ? 4 : 0;
+    }
+    return intersect_scalar(skip_emitted(a, emitted), a_end, b, b_end, out);
+}
+
+#endif
+
+}  // namespace detail
+
+template <class T>
+struct is_intersectable : std::bool_constant<std::is_integral_v<T> && (sizeof(T) == 4 || sizeof(T) == 8)>
+{
+};
+
+// Intersection of two strictly increasing arrays of 32 or 64 bit integers. Inputs of very different sizes are
+// galloped through, others are compared block-wise. Duplicated input values may be written more than once, but
+// never more than (a_end - a) values are written.
+template <class T>
+T* set_intersection(const T* a, const T* a_end, const T* b, const T* b_end, T* out)
+{
+    static_assert(is_intersectable<T>::value, "simd::set_intersection: 32 or 64 bit integers required");
+
+    constexpr std::ptrdiff_t gallop_ratio = 32;
+    if ((a_end - a) * gallop_ratio < (b_end - b))
+    {
+        return detail::intersect_galloping(a, a_end, b, b_end, out);
+    }
+    if ((b_end - b) * gallop_ratio < (a_end - a))
+    {
+        return detail::intersect_galloping(b, b_end, a, a_end, out);
+    }
+#if CPP_PIPELINES_SIMD_X86
+    if constexpr (sizeof(T) == 4)
+    {
+        return has_avx2()
+                   ? detail::intersect_avx2_32(a, a_end, b, b_end, out)
+                   : detail::intersect_sse2_32(a, a_end, b, b_end, out);
+    }
+    else
+    {
+        return has_avx2()
+                   ? detail::intersect_avx2_64(a, a_end, b, b_end, out)
+                   : detail::intersect_scalar(a, a_end, b, b_end, out);
+    }
+#else
+    return detail::intersect_scalar(a, a_end, b, b_end, out);
+#endif
+}
+
+}  // namespace cpp_pipelines::simd
@@ -0,0 +1,489 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <stdexcept>
+#include <unordered_map>
+#include <vector>
+
+// Single-pass summaries of a stream of values. Each one is fed with push() and can be merged with another summary of
+// the same kind, e.g. one built by another thread over another part of the data.
+namespace cpp_pipelines::stats
+{
+// count, mean, variance (Welford's algorithm), minimum and maximum
+class moments
+{
+public:
+    moments() = default;
+
+    void push(double value)
+    {
+        ++_count;
+        const double delta = value - _mean;
+        _mean += delta / static_cast<double>(_count);
+        _m2 += delta * (value - _mean);
+        _min = std::min(_min, value);
+        _max = std::max(_max, value);
+    }
+
+    // Chan's formula for the union of two samples
+    void merge(const moments& other)
+    {
+        if (other._count == 0)
+        {
+            return;
+        }
+        if (_count == 0)
+        {
+            *this = other;
+            return;
+        }
+        const double count = static_cast<double>(_count + other._count);
+        const double delta = other._mean - _mean;
+        _mean += delta * static_cast<double>(other._count) / count;
+        _m2 += other._m2 + delta * delta * static_cast<double>(_count) * static_cast<double>(other._count) / count;
+        _count += other._count;
+        _min = std::min(_min, other._min);
+        _max = std::max(_max, other._max);
+    }
+
+    std::uint64_t count() const
+    {
+        return _count;
+    }
+
+    double mean() const
+    {
+        return _count > 0 ? _mean : std::numeric_limits<double>::quiet_NaN();
+    }
+
+    double sum() const
+    {
+        return _mean * static_cast<double>(_count);
+    }
+
+    // population variance; sample_variance divides by (count - 1)
+    double variance() const
+    {
+        return _count > 0 ? _m2 / static_cast<double>(_count) : std::numeric_limits<double>::quiet_NaN();
+    }
+
+    double sample_variance() const
+    {
+        return _count > 1 ? _m2 / static_cast<double>(_count - 1) : std::numeric_limits<double>::quiet_NaN();
+    }
+
+    double stddev() const
+    {
+        return std::sqrt(variance());
+    }
+
+    double min() const
+    {
+        return _count > 0 ? _min : std::numeric_limits<double>::quiet_NaN();
+    }
+
+    double max() const
+    {
+        return _count > 0 ? _max : std::numeric_limits<double>::quiet_NaN();
+    }
+
+private:
+    std::uint64_t _count = 0;
+    double _mean = 0.0;
+    double _m2 = 0.0;
+    double _min = std::numeric_limits<double>::infinity();
+    double _max = -std::numeric_limits<double>::infinity();
+};
+
+// Quantile sketch (merging t-digest): the values are clustered into centroids that are small near the extreme
+// quantiles and larger around the median, so the tails stay accurate. Memory is O(compression).
+class quantiles
+{
+public:
+    explicit quantiles(double compression = 200.0)
+        : _compression{ compression }
+    {
+        if (!(compression >= 10.0))
+        {
+            throw std::invalid_argument{ "stats::quantiles: compression of at least 10 required" };
+        }
+    }
+
+    void push(double value, double weight = 1.0)
+    {
+        _buffer.push_back({ value, weight });
+        _total += weight;
+        _min = std::min(_min, value);
+        _max = std::max(_max, value);
+        if (_buffer.size() >= buffer_limit())
+        {
+            compress();
+        }
+    }
+
+    void merge(const quantiles& other)
+    {
+        _buffer.insert(_buffer.end(), other._centroids.begin(), other._centroids.end());
+        _buffer.insert(_buffer.end(), other._buffer.begin(), other._buffer.end());
+        _total += other._total;
+        _min = std::min(_min, other._min);
+        _max = std::max(_max, other._max);
+        compress();
+    }
+
+    double count() const
+    {
+        return _total;
+    }
+
+    // the value below which a fraction q of the weight lies, interpolated between the centroids
+    double quantile(double q) const
+    {
+        compress();
+        if (_centroids.empty())
+        {
+            return std::numeric_limits<double>::quiet_NaN();
+        }
+        const double target = std::clamp(q, 0.0, 1.0) * _total;
+        const centroid& first = _centroids.front();
+        if (target <= first.weight / 2)
+        {
+            return interpolate(_min, first.mean, first.weight / 2 > 0 ? target / (first.weight / 2) : 1.0);
+        }
+        double cumulative = first.weight / 2;
+        for (std::size_t i = 1; i < _centroids.size(); ++i)
+        {
+            const double step = (_centroids[i - 1].weight + _centroids[i].weight) / 2;
+            if (target <= cumulative + step)
+            {
+                return interpolate(_centroids[i - 1].mean, _centroids[i].mean, (target - cumulative) / step);
+            }
+            cumulative += step;
+        }
+        const centroid& last = _centroids.back();
+        return interpolate(last.mean, _max, std::min((target - cumulative) / (last.weight / 2), 1.0));
+    }
+
+    double median() const
+    {
+        return quantile(0.5);
+    }
+
+private:
+    struct centroid
+    {
+        double mean;
+        double weight;
+    };
+
+    std::size_t buffer_limit() const
+    {
+        return static_cast<std::size_t>(5 * _compression);
+    }
+
+    static constexpr inline double pi = 3.14159265358979323846;
+
+    static double interpolate(double lhs, double rhs, double t)
+    {
+        return lhs + (rhs - lhs) * t;
+    }
+
+    // scale function k1: the centroids spanning one unit of k hold little weight near q = 0 and q = 1
+    double scale(double q) const
+    {
+        return _compression / (2 * pi) * std::asin(2 * q - 1);
+    }
+
+    double inverse_scale(double k) const
+    {
+        return (std::sin(std::min(k, _compression / 4) * 2 * pi / _compression) + 1) / 2;
+    }
+
+    void compress() const
+    {
+        if (_buffer.empty())
+        {
+            return;
+        }
+        _buffer.insert(_buffer.end(), _centroids.begin(), _centroids.end());
+        std::sort(
+            _buffer.begin(), _buffer.end(), [](const centroid& lhs, const centroid& rhs) { return lhs.mean < rhs.mean; });
+        _centroids.clear();
+
+        double weight_before = 0;
+        double limit = inverse_scale(scale(0) + 1) * _total;
+        centroid current = _buffer.front();
+        for (std::size_t i = 1; i < _buffer.size(); ++i)
+        {
+            const centroid& next = _buffer[i];
+            if (weight_before + current.weight + next.weight <= limit)
+            {
+                current.weight += next.weight;
+                current.mean += (next.mean - current.mean) * next.weight / current.weight;
+            }
+            else
+            {
+                weight_before += current.weight;
+                limit = inverse_scale(scale(weight_before / _total) + 1) * _total;
+                _centroids.push_back(current);
+                current = next;
+            }
+        }
+        _centroids.push_back(current);
+        _buffer.clear();
+    }
+
+    double _compression;
+    double _total = 0;
+    double _min = std::numeric_limits<double>::infinity();
+    double _max = -std::numeric_limits<double>::infinity();
+    // the queries compress the pending values first
+    mutable std::vector<centroid> _centroids;
+    mutable std::vector<centroid> _buffer;
+};
+
+// Distinct count estimate (HyperLogLog): 2^precision one-byte registers, standard error about 1.04 / sqrt(2^precision).
+class distinct_count
+{
+public:
+    explicit distinct_count(unsigned precision = 12)
+        : _precision{ precision }
+        , _registers(std::size_t{ 1 } << precision)
+    {
+        if (precision < 4 || precision > 18)
+        {
+            throw std::invalid_argument{ "stats::distinct_count: precision in [4, 18] required" };
+        }
+    }
+
+    template <class T, class Hash = std::hash<T>>
+    void push(const T& item, const Hash& hash = {})
+    {
+        push_hash(static_cast<std::uint64_t>(hash(item)));
+    }
+
+    // the hash is mixed again, since std::hash is often the identity for integers
+    void push_hash(std::uint64_t hash)
+    {
+        hash = mix(hash);
+        const std::size_t index = static_cast<std::size_t>(hash >> (64 - _precision));
+        const std::uint64_t rest = (hash << _precision) | (std::uint64_t{ 1 } << (_precision - 1));
+        const auto rank = static_cast<std::uint8_t>(leading_zeros(rest) + 1);
+        _registers[index] = std::max(_registers[index], rank);
+    }
+
+    void merge(const distinct_count& other)
+    {
+        if (other._precision != _precision)
+        {
+            throw std::invalid_argument{ "stats::distinct_count: merge of different precisions" };
+        }
+        std::transform(
+            _registers.begin(),
+            _registers.end(),
+            other._registers.begin(),
+            _registers.begin(),
+            [](std::uint8_t lhs, std::uint8_t rhs) { return std::max(lhs, rhs); });
+    }
+
+    double estimate() const
+    {
+        const double m = static_cast<double>(_registers.size());
+        double sum = 0;
+        std::size_t zeros = 0;
+        for (const std::uint8_t value : _registers)
+        {
+            sum += std::ldexp(1.0, -value);
+            zeros += value == 0 ? 1 : 0;
+        }
+        const double alpha = 0.7213 / (1 + 1.079 / m);
+        const double raw = alpha * m * m / sum;
+        // linear counting is more accurate while many registers are still empty
+        return raw <= 2.5 * m && zeros > 0 ? m * std::log(m / static_cast<double>(zeros)) : raw;
+    }
+
+private:
+    static std::uint64_t mix(std::uint64_t x)
+    {
+        x ^= x >> 30;
+        x *= 0xbf58476d1ce4e5b9ULL;
+        x ^= x >> 27;
+        x *= 0x94d049bb133111ebULL;
+        return x ^ (x >> 31);
+    }
+
+    static unsigned leading_zeros(std::uint64_t x)
+    {
+#if defined(__GNUC__)
+        return static_cast<unsigned>(__builtin_clzll(x));
+#else
+        unsigned result = 0;
+        for (std::uint64_t bit = std::uint64_t{ 1 } << 63; (x & bit) == 0; bit >>= 1)
+        {
+            ++result;
+        }
+        return result;
+#endif
+    }
+
+    unsigned _precision;
+    std::vector<std::uint8_t> _registers;
+};
+
+// Most frequent items (space-saving): 'capacity' counters; an unmonitored item takes over the smallest counter, whose
+// count becomes its overestimation 'error'. Every item more frequent than total / capacity is reported.
+template <class T, class Hash = std::hash<T>, class Equal = std::equal_to<T>>
+class heavy_hitters
+{
+public:
+    struct entry
+    {
+        T item;
+        std::uint64_t count;
+        std::uint64_t error;
+    };
+
+    explicit heavy_hitters(std::size_t capacity = 64)
+        : _capacity{ capacity }
+    {
+        if (capacity == 0)
+        {
+            throw std::invalid_argument{ "stats::heavy_hitters: positive capacity required" };
+        }
+        _entries.reserve(capacity);
+    }
+
+    void push(const T& item, std::uint64_t weight = 1)
+    {
+        const auto found = _positions.find(item);
+        if (found != _positions.end())
+        {
+            _entries[found->second].count += weight;
+            sift_down(found->second);
+        }
+        else if (_entries.size() < _capacity)
+        {
+            _entries.push_back({ item, weight, 0 });
+            _positions.emplace(item, _entries.size() - 1);
+            sift_up(_entries.size() - 1);
+        }
+        else
+        {
+            entry& smallest = _entries.front();
+            _positions.erase(smallest.item);
+            smallest.error = smallest.count;
+            smallest.count += weight;
+            smallest.item = item;
+            _positions.emplace(item, 0);
+            sift_down(0);
+        }
+    }
+
+    // an item missing from one of the summaries may have occurred up to its smallest count there
+    void merge(const heavy_hitters& other)
+    {
+        const std::uint64_t this_floor = floor();
+        const std::uint64_t other_floor = other.floor();
+        std::vector<entry> combined;
+        combined.reserve(_entries.size() + other._entries.size());
+        for (const entry& e : _entries)
+        {
+            const auto found = other._positions.find(e.item);
+            const entry* match = found != other._positions.end() ? &other._entries[found->second] : nullptr;
+            combined.push_back(
+                { e.item,
+                  e.count + (match ? match->count : other_floor),
+                  e.error + (match ? match->error : other_floor) });
+        }
+        for (const entry& e : other._entries)
+        {
+            if (_positions.find(e.item) == _positions.end())
+            {
+                combined.push_back({ e.item, e.count + this_floor, e.error + this_floor });
+            }
+        }
+        const std::size_t size = std::min(combined.size(), _capacity);
+        std::partial_sort(
+            combined.begin(),
+            combined.begin() + size,
+            combined.end(),
+            [](const entry& lhs, const entry& rhs) { return lhs.count > rhs.count; });
+        combined.resize(size);
+
+        // a list sorted by decreasing count is reversed into a valid min-heap
+        std::reverse(combined.begin(), combined.end());
+        _entries = std::move(combined);
+        _positions.clear();
+        for (std::size_t i = 0; i < _entries.size(); ++i)
+        {
+            _positions.emplace(_entries[i].item, i);
+        }
+    }
+
+    // the monitored items by decreasing count
+    std::vector<entry> top() const
+    {
+        std::vector<entry> result = _entries;
+        std::sort(result.begin(), result.end(), [](const entry& lhs, const entry& rhs) { return lhs.count > rhs.count; });
+        return result;
+    }
+
+    std::size_t capacity() const
+    {
+        return _capacity;
+    }
+
+private:
+    std::uint64_t floor() const
+    {
+        return _entries.size() < _capacity ? 0 : _entries.front().count;
+    }
+
+    // min-heap on count, '_positions' follows the moves
+    void swap_entries(std::size_t lhs, std::size_t rhs)
+    {
+        std::swap(_entries[lhs], _entries[rhs]);
+        _positions[_entries[lhs].item] = lhs;
+        _positions[_entries[rhs].item] = rhs;
+    }
+
+    void sift_up(std::size_t index)
+    {
+        while (index > 0 && _entries[index].count < _entries[(index - 1) / 2].count)
+        {
+            swap_entries(index, (index - 1) / 2);
+            index = (index - 1) / 2;
+        }
+    }
+
+    void sift_down(std::size_t index)
+    {
+        while (true)
+        {
+            std::size_t smallest = index;
+            for (const std::size_t child : { 2 * index + 1, 2 * index + 2 })
+            {
+                if (child < _entries.size() && _entries[child].count < _entries[smallest].count)
+                {
+                    smallest = child;
+                }
+            }
+            if (smallest == index)
+            {
+                return;
+            }
+            swap_entries(index, smallest);
+            index = smallest;
+        }
+    }
+
+    std::size_t _capacity;
+    std::vector<entry> _entries;
+    std::unordered_map<T, std::size_t, Hash, Equal> _positions;
+};
+
+}  // namespace cpp_pipelines::stats
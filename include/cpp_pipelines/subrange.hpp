@@ -75,4 +75,19 @@ using span = subrange<T*>;
 template <class T>
 using const_span = subrange<const T*>;
 
+template <class Range>
+constexpr auto as_span(Range&& range)
+{
+    static_assert(is_contiguous_range<Range>::value, "as_span: contiguous range required");
+    if constexpr (std::is_pointer_v<iterator_t<Range>>)
+    {
+        return subrange{ std::begin(range), std::end(range) };
+    }
+    else
+    {
+        const auto b = std::data(range);
+        return subrange{ b, b + std::size(range) };
+    }
+}
+
 }  // namespace cpp_pipelines
\ No newline at end of file
@@ -34,6 +34,9 @@ using is_bidirectional_iterator_impl = iterator_of_category<std::bidirectional_i
 template <class T>
 using is_random_access_iterator_impl = iterator_of_category<std::random_access_iterator_tag, T>;
 
+template <class T>
+using has_data_impl = decltype(std::data(std::declval<T&>()));
+
 template <class T>
 using has_ostream_op_impl = decltype(std::declval<std::ostream&>() << std::declval<const T&>());
 
@@ -147,6 +150,17 @@ struct is_random_access_range : is_random_access_iterator<iterator_t<T>>
 {
 };
 
+template <class T, class = std::void_t<>>
+struct is_contiguous_range : std::false_type
+{
+};
+
+template <class T>
+struct is_contiguous_range<T, std::void_t<iterator_t<T>>>
+    : std::bool_constant<std::is_pointer_v<iterator_t<T>> || is_detected_v<detail::has_data_impl, T>>
+{
+};
+
 template <class T, class = std::void_t<>>
 struct is_output_iterator : std::false_type
 {
@@ -1,6 +1,8 @@
 #pragma once
 
 #include <cpp_pipelines/pipeline.hpp>
+#include <functional>
+#include <utility>
 #include <variant>
 
 namespace cpp_pipelines::var
@@ -16,6 +18,91 @@ overloaded(Ts...) -> overloaded<Ts...>;
 
 namespace detail
 {
+struct visit_fn
+{
+    // variants with more alternatives go through std::visit
+    static constexpr inline std::size_t max_switch_size = 32;
+
+    template <class Func, class Variant>
+    constexpr decltype(auto) operator()(Func&& func, Variant&& item) const
+    {
+        constexpr std::size_t size = std::variant_size_v<std::remove_cv_t<std::remove_reference_t<Variant>>>;
+        if constexpr (size <= max_switch_size)
+        {
+            return dispatch<size>(std::forward<Func>(func), std::forward<Variant>(item));
+        }
+        else
+        {
+            return std::visit(std::forward<Func>(func), std::forward<Variant>(item));
+        }
+    }
+
+private:
+    template <class Func, class Variant, std::size_t... I>
+    static constexpr bool same_results(std::index_sequence<I...>)
+    {
+        using first = std::invoke_result_t<Func, decltype(std::get<0>(std::declval<Variant>()))>;
+        return (std::is_same_v<first, std::invoke_result_t<Func, decltype(std::get<I>(std::declval<Variant>()))>> && ...);
+    }
+
+// a switch over the index, whose arms the compiler can inline, instead of the table of function pointers of std::visit
+#define CPP_PIPELINES_VISIT_CASE(index)                                                                 \
+    case index:                                                                                         \
+        if constexpr (index < size)                                                                     \
+        {                                                                                               \
+            return std::invoke(std::forward<Func>(func), std::get<index>(std::forward<Variant>(item))); \
+        }                                                                                               \
+        [[fallthrough]]
+
+    template <std::size_t size, class Func, class Variant>
+    static constexpr decltype(auto) dispatch(Func&& func, Variant&& item)
+    {
+        static_assert(
+            same_results<Func, Variant>(std::make_index_sequence<size>{}),
+            "var::visit: the function has to return the same type for all the alternatives");
+        switch (item.index())
+        {
+            CPP_PIPELINES_VISIT_CASE(0);
+            CPP_PIPELINES_VISIT_CASE(1);
+            CPP_PIPELINES_VISIT_CASE(2);
+            CPP_PIPELINES_VISIT_CASE(3);
+            CPP_PIPELINES_VISIT_CASE(4);
+            CPP_PIPELINES_VISIT_CASE(5);
+            CPP_PIPELINES_VISIT_CASE(6);
+            CPP_PIPELINES_VISIT_CASE(7);
+            CPP_PIPELINES_VISIT_CASE(8);
+            CPP_PIPELINES_VISIT_CASE(9);
+            CPP_PIPELINES_VISIT_CASE(10);
+            CPP_PIPELINES_VISIT_CASE(11);
+            CPP_PIPELINES_VISIT_CASE(12);
+            CPP_PIPELINES_VISIT_CASE(13);
+            CPP_PIPELINES_VISIT_CASE(14);
+            CPP_PIPELINES_VISIT_CASE(15);
+            CPP_PIPELINES_VISIT_CASE(16);
+            CPP_PIPELINES_VISIT_CASE(17);
+            CPP_PIPELINES_VISIT_CASE(18);
+            CPP_PIPELINES_VISIT_CASE(19);
+            CPP_PIPELINES_VISIT_CASE(20);
+            CPP_PIPELINES_VISIT_CASE(21);
+            CPP_PIPELINES_VISIT_CASE(22);
+            CPP_PIPELINES_VISIT_CASE(23);
+            CPP_PIPELINES_VISIT_CASE(24);
+            CPP_PIPELINES_VISIT_CASE(25);
+            CPP_PIPELINES_VISIT_CASE(26);
+            CPP_PIPELINES_VISIT_CASE(27);
+            CPP_PIPELINES_VISIT_CASE(28);
+            CPP_PIPELINES_VISIT_CASE(29);
+            CPP_PIPELINES_VISIT_CASE(30);
+            CPP_PIPELINES_VISIT_CASE(31);
+            default: break;
+        }
+        // valueless by exception
+        throw std::bad_variant_access{};
+    }
+
+#undef CPP_PIPELINES_VISIT_CASE
+};
+
 struct match_fn
 {
     template <class Func>
@@ -26,7 +113,7 @@ struct match_fn
         template <class T>
         constexpr decltype(auto) operator()(T&& item) const
         {
-            return std::visit(func, std::forward<T>(item));
+            return visit_fn{}(func, std::forward<T>(item));
         }
     };
 
@@ -40,6 +127,8 @@ struct match_fn
 
 }  // namespace detail
 
+// Calls 'func' with the alternative held by the variant, like std::visit of a single variant.
+static constexpr inline auto visit = detail::visit_fn{};
 static constexpr inline auto match = detail::match_fn{};
 
 }  // namespace cpp_pipelines::var
\ No newline at end of file
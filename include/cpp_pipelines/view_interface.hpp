@@ -28,11 +28,8 @@ struct view_interface
     {
     }
 
-    constexpr view_interface& operator=(view_interface other)
-    {
-        std::swap(impl, other.impl);
-        return *this;
-    }
+    constexpr view_interface& operator=(const view_interface&) = default;
+    constexpr view_interface& operator=(view_interface&&) = default;
 
     constexpr iterator begin() const
     {
@@ -104,6 +101,12 @@ struct view_interface
     {
         return std::distance(begin(), end());
     }
+
+    template <class I = Impl, class = decltype(std::declval<const I&>().data())>
+    constexpr auto data() const
+    {
+        return impl.data();
+    }
 };
 
 template <class Impl>
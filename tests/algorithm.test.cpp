@@ -0,0 +1,169 @@
+#include <cpp_pipelines/algorithm.hpp>
+#include <cpp_pipelines/seq.hpp>
+#include <atomic>
+#include <numeric>
+#include <random>
+
+#include "test_utils.hpp"
+
+using namespace cpp_pipelines;
+
+TEST_CASE("algorithm::argsort", "[algorithm][argsort]")
+{
+    const auto values = std::vector{ 30, -10, 20, -10, 0 };
+    REQUIRE_THAT(algorithm::argsort(values), EqualsRange(std::vector<std::size_t>{ 1, 3, 4, 2, 0 }));
+    REQUIRE_THAT(algorithm::argsort(values, std::greater<>{}), EqualsRange(std::vector<std::size_t>{ 0, 2, 4, 1, 3 }));
+}
+
+TEST_CASE("algorithm::radix_sort", "[algorithm][radix_sort]")
+{
+    std::vector<int> ints = { 5, -3, 1000000, 0, -70000, 5, 42, std::numeric_limits<int>::min(), 7 };
+    std::vector<int> expected_ints = ints;
+    std::sort(expected_ints.begin(), expected_ints.end());
+    algorithm::radix_sort(ints);
+    REQUIRE_THAT(ints, EqualsRange(expected_ints));
+
+    std::vector<double> doubles = { 2.5, -1.0, 0.0, -1e300, 3.25, -0.5, 1e-9 };
+    algorithm::radix_sort(doubles);
+    REQUIRE_THAT(doubles, EqualsRange(std::vector<double>{ -1e300, -1.0, -0.5, 0.0, 1e-9, 2.5, 3.25 }));
+
+    using record = std::pair<std::uint64_t, std::string>;
+    std::vector<record> records = { { 300, "a" }, { 2, "b" }, { 1ull << 40, "c" }, { 2, "d" }, { 300, "e" } };
+    algorithm::radix_sort(records, &record::first);
+    REQUIRE_THAT(
+        (records |= seq::transform(&record::second)), EqualsRange(std::vector<std::string>{ "b", "d", "a", "e", "c" }));
+}
+
+TEST_CASE("algorithm - execution policies", "[algorithm][execution]")
+{
+    std::vector<int> values(100000);
+    std::iota(values.begin(), values.end(), 0);
+    std::shuffle(values.begin(), values.end(), std::mt19937{ 42 });
+
+    const auto square = [](int x) { return static_cast<long long>(x) * x; };
+    REQUIRE(algorithm::reduce(execution::par, values, 0LL) == 4999950000LL);
+    REQUIRE(
+        algorithm::transform_reduce(execution::par, values, 0LL, std::plus<>{}, square)
+        == algorithm::transform_reduce(values, 0LL, std::plus<>{}, square));
+    REQUIRE(algorithm::count_if(execution::par, values, [](int x) { return x % 3 == 0; }) == 33334);
+    const auto is_large = [](int x) { return x >= 99990; };
+    REQUIRE(algorithm::find_if(execution::par, values, is_large) == algorithm::find_if(values, is_large));
+    REQUIRE(algorithm::any_of(execution::par, values, [](int x) { return x == 12345; }));
+    REQUIRE(algorithm::none_of(execution::par_unseq, values, [](int x) { return x < 0; }));
+    REQUIRE(algorithm::all_of(execution::seq, values, [](int x) { return x < 100000; }));
+
+    std::vector<int> evens(values.size());
+    const auto evens_end = algorithm::copy_if(execution::par, values, evens.begin(), [](int x) { return x % 2 == 0; });
+    evens.resize(std::distance(evens.begin(), evens_end));
+    std::vector<int> expected_evens;
+    algorithm::copy_if(values, std::back_inserter(expected_evens), [](int x) { return x % 2 == 0; });
+    REQUIRE(evens == expected_evens);
+
+    std::vector<long long> scanned(values.size());
+    std::vector<long long> expected_scan(values.size());
+    algorithm::inclusive_scan(execution::par, values, scanned.begin(), std::plus<>{}, square);
+    algorithm::inclusive_scan(values, expected_scan.begin(), std::plus<>{}, square);
+    REQUIRE(scanned == expected_scan);
+    algorithm::exclusive_scan(execution::par, values, scanned.begin(), 7LL, std::plus<>{});
+    algorithm::exclusive_scan(values, expected_scan.begin(), 7LL, std::plus<>{});
+    REQUIRE(scanned == expected_scan);
+
+    std::vector<int> doubled(values.size());
+    algorithm::transform(execution::par, values, doubled.begin(), [](int x) { return 2 * x; });
+    REQUIRE(doubled[10] == 2 * values[10]);
+
+    auto sorted = values;
+    algorithm::sort(execution::par, sorted, std::greater<>{});
+    REQUIRE(algorithm::is_sorted(sorted, std::greater<>{}));
+    REQUIRE(sorted.front() == 99999);
+
+    using record = std::pair<int, int>;
+    std::vector<record> records;
+    algorithm::transform(values, std::back_inserter(records), [](int x) { return record{ x % 100, x }; });
+    auto expected_records = records;
+    algorithm::stable_sort(execution::par, records, std::less<>{}, &record::first);
+    algorithm::stable_sort(expected_records, std::less<>{}, &record::first);
+    REQUIRE(records == expected_records);
+
+    std::atomic<long long> total{ 0 };
+    algorithm::for_each(execution::par, values, [&](int x) { total += x; });
+    REQUIRE(total == 4999950000LL);
+}
+
+TEST_CASE("algorithm - execution policies rethrow", "[algorithm][execution]")
+{
+    std::vector<int> values(10000, 1);
+    REQUIRE_THROWS_AS(
+        algorithm::for_each(execution::par, values, [](int) { throw std::runtime_error{ "x" }; }), std::runtime_error);
+}
+
+TEST_CASE("algorithm - vectorized reductions", "[algorithm][simd]")
+{
+    std::mt19937 generator{ 7 };
+    std::vector<int> ints(1003);
+    std::vector<double> doubles(1003);
+    for (std::size_t i = 0; i < ints.size(); ++i)
+    {
+        ints[i] = static_cast<int>(generator() % 2000) - 1000;
+        doubles[i] = ints[i] / 8.0;
+    }
+    ints[500] = -5000;
+    ints[700] = -5000;
+    const auto& const_ints = ints;
+
+    REQUIRE(algorithm::reduce(ints, 10) == std::accumulate(ints.begin(), ints.end(), 10));
+    // multiples of 1/8 add up exactly in any order
+    REQUIRE(algorithm::reduce(doubles, 0.0) == std::accumulate(doubles.begin(), doubles.end(), 0.0));
+    REQUIRE(
+        algorithm::transform_reduce(ints, 0LL, std::plus<>{}, [](int x) { return static_cast<long long>(x) * x; })
+        == std::inner_product(ints.begin(), ints.end(), ints.begin(), 0LL));
+    REQUIRE(algorithm::inner_product(ints, seq::reverse(ints), 0) == std::inner_product(ints.begin(), ints.end(), ints.rbegin(), 0));
+    REQUIRE(algorithm::inner_product(const_ints, const_ints, 1) == std::inner_product(ints.begin(), ints.end(), ints.begin(), 1));
+
+    REQUIRE(algorithm::min_element(ints) == ints.begin() + 500);
+    REQUIRE(algorithm::max_element(ints) == std::max_element(ints.begin(), ints.end()));
+    REQUIRE(algorithm::min_element(std::vector<int>{}) == algorithm::min_element(std::vector<int>{}));
+
+    REQUIRE(algorithm::count_if(ints, less(10)) == std::count_if(ints.begin(), ints.end(), [](int x) { return x < 10; }));
+    REQUIRE(algorithm::count_if(ints, less.bind_left(10)) == std::count_if(ints.begin(), ints.end(), [](int x) { return 10 < x; }));
+    REQUIRE(algorithm::count_if(doubles, greater_equal(3)) == std::count_if(doubles.begin(), doubles.end(), [](double x) { return x >= 3; }));
+    REQUIRE(algorithm::count_if(ints, less(2.5)) == std::count_if(ints.begin(), ints.end(), [](int x) { return x < 2.5; }));
+    REQUIRE(algorithm::count_if(std::vector<unsigned>{ 1, 2, 3 }, less(-5L)) == 0);
+    REQUIRE(algorithm::count(ints, -5000) == 2);
+    REQUIRE(algorithm::count(doubles, 0.5) == std::count(doubles.begin(), doubles.end(), 0.5));
+    REQUIRE(algorithm::count_if(std::vector<int>{ -1, 3 }, less(5u)) == 1);
+    REQUIRE(algorithm::count_if(ints, between(-100, 100)) == std::count_if(ints.begin(), ints.end(), [](int x) { return -100 <= x && x <= 100; }));
+}
+
+TEST_CASE("algorithm::compress", "[algorithm][simd]")
+{
+    std::mt19937 generator{ 11 };
+    std::vector<int> ints(1003);
+    std::vector<float> floats(1003);
+    std::vector<std::int64_t> longs(1003);
+    for (std::size_t i = 0; i < ints.size(); ++i)
+    {
+        ints[i] = static_cast<int>(generator() % 2000) - 1000;
+        floats[i] = ints[i] / 4.0f;
+        longs[i] = ints[i] * 1000000000LL;
+    }
+
+    const auto expected = [](const auto& range, auto pred)
+    {
+        std::vector<typename std::decay_t<decltype(range)>::value_type> result;
+        std::copy_if(range.begin(), range.end(), std::back_inserter(result), pred);
+        return result;
+    };
+
+    REQUIRE_THAT(algorithm::compress(ints, less(0)), EqualsRange(expected(ints, [](int x) { return x < 0; })));
+    REQUIRE_THAT(algorithm::compress(ints, equal_to(7)), EqualsRange(expected(ints, [](int x) { return x == 7; })));
+    REQUIRE_THAT(algorithm::compress(floats, greater(12.5)), EqualsRange(expected(floats, [](float x) { return x > 12.5; })));
+    REQUIRE_THAT(algorithm::compress(floats, between(-10.f, 10.f)), EqualsRange(expected(floats, [](float x) { return -10 <= x && x <= 10; })));
+    REQUIRE_THAT(algorithm::compress(longs, less_equal(0)), EqualsRange(expected(longs, [](std::int64_t x) { return x <= 0; })));
+    REQUIRE_THAT(algorithm::compress(ints, less(0), [](int x) { return -x; }), EqualsRange(expected(ints, [](int x) { return x > 0; })));
+    REQUIRE(algorithm::compress(std::vector<int>{}, less(0)).empty());
+
+    std::vector<int> output;
+    algorithm::copy_if(ints, std::back_inserter(output), greater(500));
+    REQUIRE_THAT(output, EqualsRange(expected(ints, [](int x) { return x > 500; })));
+}
@@ -0,0 +1,68 @@
+#include <cstdlib>
+#include <new>
+
+#include "test_utils.hpp"
+
+// Replaces the global allocation functions to count the calls made by each thread; the array forms call these ones. The
+// nothrow and sized forms are replaced as well, so that no allocation is released by a deallocation function of another
+// allocator (e.g. the ones of a sanitizer runtime).
+
+std::size_t& allocation_count()
+{
+    static thread_local std::size_t count = 0;
+    return count;
+}
+
+void* operator new(std::size_t size)
+{
+    ++allocation_count();
+    if (void* ptr = std::malloc(size == 0 ? 1 : size))
+    {
+        return ptr;
+    }
+    throw std::bad_alloc{};
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment)
+{
+    ++allocation_count();
+    const auto align = static_cast<std::size_t>(alignment);
+    if (void* ptr = std::aligned_alloc(align, (size + align - 1) / align * align))
+    {
+        return ptr;
+    }
+    throw std::bad_alloc{};
+}
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept
+{
+    ++allocation_count();
+    return std::malloc(size == 0 ? 1 : size);
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept
+{
+    ++allocation_count();
+    const auto align = static_cast<std::size_t>(alignment);
+    return std::aligned_alloc(align, (size + align - 1) / align * align);
+}
+
+void operator delete(void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, std::align_val_t) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t, std::align_val_t) noexcept
+{
+    std::free(ptr);
+}
@@ -1,5 +1,6 @@
 #include <cpp_pipelines/map.hpp>
 #include <cpp_pipelines/output.hpp>
+#include <cpp_pipelines/seq/to.hpp>
 
 #include "test_utils.hpp"
 
@@ -55,3 +56,61 @@ TEST_CASE("map::items")
     std::multimap<int, int> m = { { 1, 2 }, { 2, 4 }, { 3, 9 }, { 1, 5 }, { 2, 4 } };
     REQUIRE_THAT(m |= map::items, EqualsRange(std::vector<std::pair<int, std::vector<int>>>{ { 1, { 2, 5 } }, { 2, { 4, 4 } }, { 3, { 9 } } }));
 }
+
+TEST_CASE("map::groups")
+{
+    const auto values = [](const auto& group) { return group.second |= seq::transform(get_value); };
+    const std::multimap<int, int> m = { { 1, 2 }, { 2, 4 }, { 3, 9 }, { 1, 5 }, { 2, 4 } };
+    REQUIRE_THAT(m |= map::groups |= seq::transform(get_key), EqualsRange(std::vector{ 1, 2, 3 }));
+    REQUIRE_THAT(m |= map::groups |= seq::transform(values) |= seq::transform(seq::to_vector), EqualsRange(std::vector<std::vector<int>>{ { 2, 5 }, { 4, 4 }, { 9 } }));
+
+    const std::vector<std::pair<int, char>> sorted = { { 1, 'a' }, { 1, 'b' }, { 1, 'c' }, { 1, 'd' }, { 1, 'e' }, { 1, 'f' }, { 2, 'g' }, { 3, 'h' }, { 3, 'i' } };
+    REQUIRE_THAT(sorted |= map::groups |= seq::transform(values) |= seq::transform(seq::to_vector), EqualsRange(std::vector<std::vector<char>>{ { 'a', 'b', 'c', 'd', 'e', 'f' }, { 'g' }, { 'h', 'i' } }));
+    REQUIRE_THAT((std::vector<std::pair<int, char>>{} |= map::groups |= seq::transform(get_key)), EqualsRange(std::vector<int>{}));
+}
+
+TEST_CASE("map::keys - unordered_multimap")
+{
+    std::unordered_multimap<int, int> m = { { 1, 2 }, { 2, 4 }, { 3, 9 }, { 1, 5 }, { 2, 4 } };
+    auto keys = m |= map::keys |= seq::to_vector;
+    std::sort(keys.begin(), keys.end());
+    REQUIRE(keys == std::vector{ 1, 2, 3 });
+}
+
+TEST_CASE("seq::to_flat_map")
+{
+    const auto result = std::vector{ std::pair{ 3, 'c' }, std::pair{ 1, 'a' }, std::pair{ 2, 'b' }, std::pair{ 1, 'x' } } |= seq::to_flat_map;
+    REQUIRE(result.container() == std::vector{ std::pair{ 1, 'a' }, std::pair{ 2, 'b' }, std::pair{ 3, 'c' } });
+    REQUIRE((result |= map::at(2)) == 'b');
+    REQUIRE((result |= map::maybe_at(5)) == std::nullopt);
+    REQUIRE_THAT(result |= map::keys, EqualsRange(std::vector{ 1, 2, 3 }));
+}
+
+TEST_CASE("flat_map")
+{
+    auto m = flat_map<std::string, int>{};
+    m["b"] = 2;
+    m["a"] = 1;
+    m["b"] += 10;
+    REQUIRE(m.container() == std::vector{ std::pair{ "a"s, 1 }, std::pair{ "b"s, 12 } });
+    REQUIRE(m.at("a") == 1);
+    REQUIRE_THROWS(m.at("c"));
+}
+
+TEST_CASE("flat_map - keys are read only through iterators")
+{
+    auto m = flat_map<std::string, int>{ { "b"s, 2 }, { "a"s, 1 } };
+    STATIC_REQUIRE(!std::is_assignable_v<decltype((m.begin()->first)), std::string>);
+    STATIC_REQUIRE(!std::is_assignable_v<decltype((std::as_const(m).begin()->second)), int>);
+    STATIC_REQUIRE(std::is_same_v<iter_value_t<flat_map<std::string, int>::iterator>, std::pair<std::string, int>>);
+    for (auto&& [key, value] : m)
+    {
+        value *= 10;
+    }
+    m.begin()->second += 1;
+    flat_map<std::string, int>::const_iterator it = m.find("b");
+    REQUIRE(it->second == 20);
+    REQUIRE(it - m.begin() == 1);
+    REQUIRE(m.container() == std::vector{ std::pair{ "a"s, 11 }, std::pair{ "b"s, 20 } });
+    REQUIRE(std::vector<std::pair<std::string, int>>(m.begin(), m.end()) == m.container());
+}
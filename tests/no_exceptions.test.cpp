@@ -0,0 +1,32 @@
+// Built with -fno-exceptions (see CMakeLists.txt): the result<T, E> pipelines must not need them. CHECK rather than
+// REQUIRE, as a failed REQUIRE throws out of this translation unit.
+#include <catch2/catch_test_macros.hpp>
+#include <cpp_pipelines/res.hpp>
+#include <cpp_pipelines/seq.hpp>
+
+using namespace cpp_pipelines;
+
+TEST_CASE("seq - result pipelines without exceptions", "[seq][res][no_exceptions]")
+{
+    const auto parse = [](const std::string& text) -> result<int, std::string>
+    {
+        if (text.empty() || !std::all_of(text.begin(), text.end(), [](char c) { return c >= '0' && c <= '9'; }))
+        {
+            return error("not a number: " + text);
+        }
+        return std::accumulate(text.begin(), text.end(), 0, [](int total, char c) { return total * 10 + (c - '0'); });
+    };
+
+    const std::vector<std::string> valid = { "1", "22", "333" };
+    const auto values = valid |= seq::transform_res(parse) |= seq::collect_result;
+    CHECK(values.has_value());
+    CHECK(*values == std::vector{ 1, 22, 333 });
+    CHECK((*values |= seq::maybe_accumulate(std::plus<>{})) == 356);
+
+    const std::vector<std::string> invalid = { "1", "x", "3" };
+    const auto first_error = invalid |= seq::transform_res(parse) |= seq::collect_result;
+    CHECK(first_error.has_error());
+    CHECK(first_error.error() == "not a number: x");
+
+    CHECK(!(std::vector<int>{} |= seq::maybe_accumulate(std::plus<>{})));
+}
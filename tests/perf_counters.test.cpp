@@ -0,0 +1,50 @@
+#include <catch2/catch_test_macros.hpp>
+#include <cpp_pipelines/perf_counters.hpp>
+#include <cpp_pipelines/seq.hpp>
+#include <sstream>
+
+using namespace cpp_pipelines;
+
+TEST_CASE("perf_report", "[perf_counters]")
+{
+    const perf_report report = { 2000.0, 3000.0, 10.0, std::nullopt, 40.0 };
+    REQUIRE(report.ipc() == 1.5);
+
+    const perf_report per_element = report.per(10);
+    REQUIRE(per_element.cycles == 200.0);
+    REQUIRE(per_element.instructions == 300.0);
+    REQUIRE(per_element.branch_misses == 1.0);
+    REQUIRE(!per_element.l1d_misses);
+    REQUIRE(per_element.llc_misses == 4.0);
+    REQUIRE(per_element.ipc() == 1.5);
+    REQUIRE(!report.per(0).cycles);
+    REQUIRE(!perf_report{}.ipc());
+
+    std::ostringstream os;
+    os << per_element;
+    REQUIRE(os.str() == "cycles=200 instructions=300 ipc=1.5 branch_misses=1 l1d_misses=n/a llc_misses=4");
+}
+
+TEST_CASE("perf_counters", "[perf_counters]")
+{
+    // the events may not be available here, the counters have to work anyway
+    const perf_counters counters;
+    const std::vector<int> values = seq::iota(0, 10000) |= seq::to_vector;
+    const perf_report report = counters.read();
+    if (counters.available())
+    {
+        REQUIRE((report.cycles || report.instructions || report.branch_misses || report.l1d_misses || report.llc_misses));
+    }
+    else
+    {
+        REQUIRE(!report.cycles);
+        REQUIRE(!report.instructions);
+    }
+
+    const auto even = [](int x) { return x % 2 == 0; };
+    const perf_report per_element = measure_per_element(values |= seq::filter(even));
+    if (per_element.instructions)
+    {
+        REQUIRE(*per_element.instructions > 0.0);
+    }
+}
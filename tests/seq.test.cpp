@@ -2,6 +2,7 @@
 #include <cpp_pipelines/macros.hpp>
 #include <cpp_pipelines/seq.hpp>
 #include <cpp_pipelines/tpl.hpp>
+#include <random>
 
 #include "test_utils.hpp"
 
@@ -52,6 +53,33 @@ TEST_CASE("seq::filter", "[seq][filter]")
     };
     REQUIRE_THAT((std::vector<int>{} |= seq::filter(is_even)), EqualsRange(std::vector<int>{}));
     REQUIRE_THAT((std::vector{ 1, 2, 3, 4, 5, 6, 8 } |= seq::filter(is_even)), EqualsRange(std::vector{ 2, 4, 6, 8 }));
+
+    std::stringstream ss{ "1 2 3 4 5 6" };
+    const std::vector<int> evens = seq::istream<int>(ss) |= seq::filter(is_even) |= seq::to_vector;
+    REQUIRE(evens == std::vector{ 2, 4, 6 });
+}
+
+template <class Range>
+using iterator_category_of = typename std::iterator_traits<iterator_t<const Range>>::iterator_category;
+
+TEST_CASE("seq - adaptors over single pass ranges", "[seq][iterator]")
+{
+    const auto is_even = [](int x) { return x % 2 == 0; };
+    const auto square = [](int x) { return x * x; };
+    std::stringstream ss{ "1 2 3 4" };
+    const auto numbers = seq::istream<int>(ss);
+    const auto evens = numbers |= seq::filter(is_even);
+    const auto squares = numbers |= seq::transform(square);
+    const auto taken = numbers |= seq::take_while(is_even);
+    STATIC_REQUIRE(std::is_same_v<iterator_category_of<decltype(evens)>, std::input_iterator_tag>);
+    STATIC_REQUIRE(std::is_same_v<iterator_category_of<decltype(squares)>, std::input_iterator_tag>);
+    STATIC_REQUIRE(std::is_same_v<iterator_category_of<decltype(taken)>, std::input_iterator_tag>);
+
+    const std::vector<int> values = { 1, 2, 3, 4 };
+    STATIC_REQUIRE(std::is_same_v<iterator_category_of<decltype(values |= seq::filter(is_even))>, std::bidirectional_iterator_tag>);
+    STATIC_REQUIRE(std::is_same_v<iterator_category_of<decltype(values |= seq::transform(square))>, std::random_access_iterator_tag>);
+
+    REQUIRE_THAT(squares |= seq::to_vector, EqualsRange(std::vector{ 1, 4, 9, 16 }));
 }
 
 TEST_CASE("seq::filter - reverse iterator", "[seq][filter]")
@@ -162,6 +190,33 @@ TEST_CASE("seq::intersperse", "[seq][intersperse]")
     REQUIRE_THAT((std::vector{ 10, 11, 12 } |= seq::intersperse(-1)), EqualsRange(std::vector{ 10, -1, 11, -1, 12 }));
 }
 
+TEST_CASE("seq::adjacent", "[seq][adjacent]")
+{
+    std::vector<int> values = { 1, 2, 3, 4 };
+    REQUIRE_THAT(values |= seq::pairwise, EqualsRange(std::vector<std::tuple<int, int>>{ { 1, 2 }, { 2, 3 }, { 3, 4 } }));
+    REQUIRE_THAT(values |= seq::adjacent<3>, EqualsRange(std::vector<std::tuple<int, int, int>>{ { 1, 2, 3 }, { 2, 3, 4 } }));
+    REQUIRE_THAT(values |= seq::adjacent<5>, EqualsRange(std::vector<std::tuple<int, int, int, int, int>>{}));
+
+    for (auto [first, second] : values |= seq::pairwise)
+    {
+        second += first;
+    }
+    REQUIRE_THAT(values, EqualsRange(std::vector{ 1, 3, 6, 10 }));
+
+    int calls = 0;
+    const auto counted = seq::transform([&](int x) { ++calls; return x * 10; });
+    REQUIRE_THAT(values |= counted |= seq::pairwise, EqualsRange(std::vector<std::tuple<int, int>>{ { 10, 30 }, { 30, 60 }, { 60, 100 } }));
+    REQUIRE(calls == 4);
+
+    // elements computed upstream are yielded by value, the tuples outlive the iterator
+    STATIC_REQUIRE(std::is_same_v<range_value_t<decltype(values |= counted |= seq::pairwise)>, std::tuple<int, int>>);
+    const auto collected = std::vector{ 1, 2, 3, 4 } |= seq::transform([](int x) { return x * 10; }) |= seq::pairwise |= seq::to_vector;
+    REQUIRE(collected == std::vector<std::tuple<int, int>>{ { 10, 20 }, { 20, 30 }, { 30, 40 } });
+
+    std::stringstream ss{ "1 2 3" };
+    REQUIRE_THAT(seq::istream<int>(ss) |= seq::pairwise, EqualsRange(std::vector<std::tuple<int, int>>{ { 1, 2 }, { 2, 3 } }));
+}
+
 TEST_CASE("seq::adjacent_transform", "[seq][adjacent_transform]")
 {
     REQUIRE_THAT((std::vector{ 1, 2, 3, 4, 5 } |= seq::adjacent_transform<3>([](int a, int b, int c) { return a + b + c; })), EqualsRange(std::vector{ 6, 9, 12 }));
@@ -182,6 +237,18 @@ TEST_CASE("seq::generate", "[seq][generate]")
         return result;
     };
     REQUIRE_THAT(seq::generate(f), EqualsRange(std::vector{ "2"s, "4"s, "8"s, "16"s, "32"s, "64"s }));
+
+
+    // every iterator carries its own copy of the generator
+    const auto numbers = seq::generate([n = 0]() mutable { return std::optional{ n++ }; });
+    STATIC_REQUIRE(is_forward_iterator<iterator_t<decltype(numbers)>>::value);
+    auto a = numbers.begin();
+    ++a;
+    ++a;
+    const auto c = numbers.begin();
+    ++a;
+    REQUIRE(*a == 3);
+    REQUIRE(*c == 0);
 }
 
 TEST_CASE("seq::generate_infinite", "[seq][generate_infinite][generate]")
@@ -334,3 +401,625 @@ TEST_CASE("seq::single", "[seq][repeat][single]")
 {
     REQUIRE_THAT(seq::single('x'), EqualsRange(std::vector{ 'x' }));
 }
+
+TEST_CASE("seq::set_union", "[seq][set_operations]")
+{
+    REQUIRE_THAT(seq::set_union(std::vector{ 1, 2, 2, 5, 7 }, std::vector{ 2, 3, 7, 9 }), EqualsRange(std::vector{ 1, 2, 2, 3, 5, 7, 9 }));
+    REQUIRE_THAT(seq::set_union(std::vector<int>{}, std::vector{ 2, 3 }), EqualsRange(std::vector{ 2, 3 }));
+}
+
+TEST_CASE("seq::set_intersection", "[seq][set_operations]")
+{
+    REQUIRE_THAT(seq::set_intersection(std::vector{ 1, 2, 2, 5, 7 }, std::vector{ 2, 3, 7, 9 }), EqualsRange(std::vector{ 2, 7 }));
+    REQUIRE_THAT(seq::set_intersection(seq::iota(0), std::vector{ 3, 5, 8 }) |= seq::take(2), EqualsRange(std::vector{ 3, 5 }));
+    REQUIRE_THAT(seq::set_intersection("abcdef"s, "BDF"s, [](char lhs, char rhs) { return std::toupper(lhs) < std::toupper(rhs); }), EqualsRange("bdf"s));
+}
+
+TEST_CASE("seq::set_difference", "[seq][set_operations]")
+{
+    REQUIRE_THAT(seq::set_difference(std::vector{ 1, 2, 2, 5, 7 }, std::vector{ 2, 3, 7, 9 }), EqualsRange(std::vector{ 1, 2, 5 }));
+    REQUIRE_THAT(seq::set_difference(seq::iota(0), std::vector{ 0, 2, 4, 6 }) |= seq::take(5), EqualsRange(std::vector{ 1, 3, 5, 7, 8 }));
+}
+
+TEST_CASE("seq::set_symmetric_difference", "[seq][set_operations]")
+{
+    REQUIRE_THAT(seq::set_symmetric_difference(std::vector{ 1, 2, 2, 5, 7 }, std::vector{ 2, 3, 7, 9 }), EqualsRange(std::vector{ 1, 2, 3, 5, 9 }));
+}
+
+TEST_CASE("seq::permute", "[seq][permute]")
+{
+    const auto words = std::vector<std::string>{ "delta", "alpha", "charlie", "bravo" };
+    REQUIRE_THAT(words |= seq::permute(std::vector{ 1, 3, 2, 0 }), EqualsRange(std::vector<std::string>{ "alpha", "bravo", "charlie", "delta" }));
+    REQUIRE_THAT(words |= seq::permute(algorithm::argsort(words, std::less<>{}, [](const std::string& w) { return w.size(); })), EqualsRange(std::vector<std::string>{ "delta", "alpha", "bravo", "charlie" }));
+    REQUIRE_THAT((words |= seq::permute(std::vector{ 0, 0, 2 }) |= seq::reverse), EqualsRange(std::vector<std::string>{ "charlie", "delta", "delta" }));
+}
+
+TEST_CASE("seq::accumulate - contiguous integers", "[seq][accumulate]")
+{
+    std::vector<std::int64_t> values(1001);
+    std::iota(values.begin(), values.end(), std::int64_t{ -300 });
+    REQUIRE((values |= seq::accumulate(std::plus<>{}, std::int64_t{ 5 })) == 200205);
+    REQUIRE((all(values) |= seq::accumulate(std::plus<>{}, std::int64_t{ 0 })) == 200200);
+    REQUIRE((values |= seq::transform([](std::int64_t x) { return x * x; }) |= seq::accumulate(std::plus<>{}, std::int64_t{ 0 })) == 123623500);
+    REQUIRE((values |= seq::filter([](std::int64_t x) { return x > 0; }) |= seq::accumulate(std::plus<>{}, std::int64_t{ 0 })) == 245350);
+}
+
+TEST_CASE("seq::transform_batch", "[seq][transform_batch]")
+{
+    std::vector<std::size_t> batches;
+    const auto square = [&](const_span<int> input, span<long> output)
+    {
+        batches.push_back(input.size());
+        std::transform(input.begin(), input.end(), output.begin(), [](int x) { return static_cast<long>(x) * x; });
+    };
+
+    const auto values = std::vector{ 1, 2, 3, 4, 5, 6, 7 };
+    REQUIRE_THAT(values |= seq::transform_batch(square, 3), EqualsRange(std::vector<long>{ 1, 4, 9, 16, 25, 36, 49 }));
+    REQUIRE_THAT(batches, EqualsRange(std::vector<std::size_t>{ 3, 3, 1 }));
+
+    batches.clear();
+    REQUIRE_THAT(std::vector<int>{} |= seq::transform_batch(square, 3), EqualsRange(std::vector<long>{}));
+    REQUIRE(batches.empty());
+
+    std::stringstream ss{ "1 2 3 4 5" };
+    REQUIRE_THAT(seq::istream<int>(ss) |= seq::transform_batch(square, 2), EqualsRange(std::vector<long>{ 1, 4, 9, 16, 25 }));
+    REQUIRE_THAT(batches, EqualsRange(std::vector<std::size_t>{ 2, 2, 1 }));
+}
+
+TEST_CASE("seq::batch", "[seq][chunk][batch]")
+{
+    const auto sizes = seq::transform([](span<int> batch) { return batch.size(); });
+    REQUIRE_THAT(seq::iota(0, 10) |= seq::batch(4) |= seq::transform(seq::to_vector), EqualsRange(std::vector<std::vector<int>>{ { 0, 1, 2, 3 }, { 4, 5, 6, 7 }, { 8, 9 } }));
+    REQUIRE_THAT(seq::iota(0, 8) |= seq::batch(4) |= sizes, EqualsRange(std::vector<std::size_t>{ 4, 4 }));
+    REQUIRE_THAT(seq::iota(0, 0) |= seq::batch(4) |= sizes, EqualsRange(std::vector<std::size_t>{}));
+
+    int next = 0;
+    std::vector<const int*> buffers;
+    const auto generated = seq::generate([&]() { return next < 7 ? std::optional{ next++ } : std::nullopt; });
+    for (const span<int> batch : generated |= seq::batch(3))
+    {
+        buffers.push_back(batch.begin());
+    }
+    REQUIRE(buffers.size() == 3);
+    REQUIRE(std::all_of(buffers.begin(), buffers.end(), [&](const int* buffer) { return buffer == buffers.front(); }));
+
+    std::stringstream ss{ "1 2 3 4 5" };
+    REQUIRE_THAT(seq::istream<int>(ss) |= seq::batch(2) |= seq::transform(seq::to_vector), EqualsRange(std::vector<std::vector<int>>{ { 1, 2 }, { 3, 4 }, { 5 } }));
+}
+
+TEST_CASE("seq::window_aggregate", "[seq][window_aggregate]")
+{
+    std::mt19937 generator{ 5 };
+    std::vector<int> values(200);
+    std::generate(values.begin(), values.end(), [&]() { return static_cast<int>(generator() % 100) - 50; });
+
+    const auto naive = [&](std::size_t size, auto func)
+    {
+        std::vector<decltype(func(values.begin(), values.begin()))> result;
+        for (std::size_t i = 0; i + size <= values.size(); ++i)
+        {
+            result.push_back(func(values.begin() + i, values.begin() + i + size));
+        }
+        return result;
+    };
+
+    for (const std::size_t size : { 1, 3, 16, 200 })
+    {
+        REQUIRE_THAT(values |= seq::window_aggregate(size, seq::window_sum), EqualsRange(naive(size, [](auto b, auto e) { return std::accumulate(b, e, 0); })));
+        REQUIRE_THAT(values |= seq::window_aggregate(size, seq::window_min), EqualsRange(naive(size, [](auto b, auto e) { return *std::min_element(b, e); })));
+        REQUIRE_THAT(values |= seq::window_aggregate(size, seq::window_max), EqualsRange(naive(size, [](auto b, auto e) { return *std::max_element(b, e); })));
+        REQUIRE_THAT(values |= seq::window_aggregate(size, std::bit_xor<>{}), EqualsRange(naive(size, [](auto b, auto e) { return std::accumulate(b, e, 0, std::bit_xor<>{}); })));
+    }
+    REQUIRE((values |= seq::window_aggregate(201, seq::window_sum) |= seq::to_vector).empty());
+
+    const auto samples = std::vector{ 1, 2, 3, 6 };
+    REQUIRE_THAT(samples |= seq::window_aggregate(2, seq::window_mean), EqualsRange(std::vector{ 1.5, 2.5, 4.5 }));
+    const auto to_string = seq::transform([](char c) { return std::string(1, c); });
+    REQUIRE_THAT("abcde"s |= to_string |= seq::window_aggregate(3, std::plus<>{}), EqualsRange(std::vector{ "abc"s, "bcd"s, "cde"s }));
+
+    int next = 0;
+    const auto generated = seq::generate([&]() { return next < 6 ? std::optional{ next++ } : std::nullopt; });
+    REQUIRE_THAT(generated |= seq::window_aggregate(3, seq::window_max), EqualsRange(std::vector{ 2, 3, 4, 5 }));
+}
+
+TEST_CASE("seq::fanout", "[seq][fanout]")
+{
+    int calls = 0;
+    const auto values = seq::iota(0, 5000) |= seq::transform([&](int x) { return ++calls, x; });
+    const auto is_even = [](int x) { return x % 2 == 0; };
+    const auto [all, evens, count, sum] = values |= seq::fanout(
+        seq::to_vector,
+        seq::filter(is_even) |= seq::to_vector,
+        seq::distance,
+        seq::accumulate(std::plus<>{}, 0L));
+    REQUIRE(calls == 5000);
+    REQUIRE_THAT(all, EqualsRange(seq::iota(0, 5000)));
+    REQUIRE(evens.size() == 2500);
+    REQUIRE(count == 5000);
+    REQUIRE(sum == 12497500L);
+
+    const auto [first, found] = seq::iota(0) |= seq::fanout(seq::take(3) |= seq::to_vector, seq::any_of([](int x) { return x == 100000; }));
+    REQUIRE_THAT(first, EqualsRange(std::vector{ 0, 1, 2 }));
+    REQUIRE(found);
+
+    std::stringstream ss{ "1 2 3 4 5" };
+    const auto [words, total] = seq::istream<int>(ss) |= seq::fanout(seq::to_vector, seq::accumulate(std::plus<>{}, 0));
+    REQUIRE_THAT(words, EqualsRange(std::vector{ 1, 2, 3, 4, 5 }));
+    REQUIRE(total == 15);
+
+    const auto failing = seq::transform([](int x) -> int { throw std::runtime_error{ std::to_string(x) }; }) |= seq::to_vector;
+    REQUIRE_THROWS_AS(seq::iota(0, 10) |= seq::fanout(seq::to_vector, failing), std::runtime_error);
+    REQUIRE((std::vector<int>{} |= seq::fanout(seq::distance)) == std::tuple{ 0 });
+}
+
+TEST_CASE("seq::route", "[seq][route]")
+{
+    enum class kind
+    {
+        small,
+        medium,
+        large
+    };
+    const auto classify = [](int x) { return x < 10 ? kind::small : x < 100 ? kind::medium : kind::large; };
+    const auto values = std::vector{ 5, 50, 500, 7, 70, 700, 9 };
+
+    for (const std::size_t batch_size : { 0, 1, 2, 100 })
+    {
+        std::vector<int> small;
+        std::stringstream large;
+        const auto medium = seq::transform([](int x) { return x / 10; }) |= seq::to_vector;
+        const auto sinks = batch_size == 0
+            ? values |= seq::route(classify, std::back_inserter(small), medium, ostream_iterator{ large, " " })
+            : values |= seq::route_batched(batch_size, classify, std::back_inserter(small), medium, ostream_iterator{ large, " " });
+        REQUIRE(small == std::vector{ 5, 7, 9 });
+        REQUIRE(std::get<1>(sinks) == std::vector{ 5, 7 });
+        REQUIRE(large.str() == "500 700 ");
+    }
+
+    const auto big = seq::iota(0, 10000) |= seq::route([](int x) { return x % 3; }, seq::distance, seq::accumulate(std::plus<>{}, 0L), seq::distance);
+    REQUIRE(big == std::tuple{ 3334, 16661667L, 3333 });
+
+    REQUIRE_THROWS_AS(values |= seq::route([](int x) { return x; }, seq::distance), std::out_of_range);
+}
+
+TEST_CASE("seq::partition_into", "[seq][route]")
+{
+    std::vector<int> evens;
+    std::vector<int> odds;
+    std::stringstream ss{ "1 2 3 4 5 6" };
+    seq::istream<int>(ss) |= seq::partition_into([](int x) { return x % 2 == 0; }, std::back_inserter(evens), std::back_inserter(odds));
+    REQUIRE(evens == std::vector{ 2, 4, 6 });
+    REQUIRE(odds == std::vector{ 1, 3, 5 });
+}
+
+TEST_CASE("seq::sort_external", "[seq][sort_external]")
+{
+    const auto directory = std::filesystem::temp_directory_path() / "cpp_pipelines_sort_external_test";
+    std::filesystem::create_directories(directory);
+
+    std::mt19937 generator{ 11 };
+    std::vector<int> values(100000);
+    std::generate(values.begin(), values.end(), [&]() { return static_cast<int>(generator() % 1000); });
+    auto expected = values;
+    std::sort(expected.begin(), expected.end());
+    {
+        const auto sorted = values |= seq::sort_external(8192, std::less<>{}, identity, directory);
+        auto it = sorted.begin();
+        REQUIRE(std::distance(std::filesystem::directory_iterator{ directory }, std::filesystem::directory_iterator{}) > 40);
+        const std::vector<int> result(it, sorted.end());
+        REQUIRE(result == expected);
+    }
+    REQUIRE(std::filesystem::is_empty(directory));
+
+    struct record
+    {
+        int key;
+        int index;
+    };
+    const auto records = seq::iota(0, 5000) |= seq::transform([](int x) { return record{ x % 7, x }; });
+    const std::vector<record> by_key = records |= seq::sort_external(1000, std::greater<>{}, &record::key, directory);
+    const auto key_then_input_order = [](const record& lhs, const record& rhs) { return lhs.key > rhs.key || (lhs.key == rhs.key && lhs.index < rhs.index); };
+    REQUIRE(std::is_sorted(by_key.begin(), by_key.end(), key_then_input_order));
+    REQUIRE(by_key.size() == 5000);
+
+    struct string_codec
+    {
+        void write(std::ostream& os, const std::string& item) const
+        {
+            os << item << '\n';
+        }
+
+        bool read(std::istream& is, std::string& item) const
+        {
+            return static_cast<bool>(std::getline(is, item));
+        }
+    };
+    std::stringstream ss{ "pear apple fig banana cherry date" };
+    const std::vector<std::string> words = seq::istream<std::string>(ss) |= seq::sort_external(2 * sizeof(std::string), std::less<>{}, identity, directory, string_codec{});
+    REQUIRE(words == std::vector<std::string>{ "apple", "banana", "cherry", "date", "fig", "pear" });
+    REQUIRE((std::vector<int>{} |= seq::sort_external(64) |= seq::to_vector).empty());
+    REQUIRE(std::filesystem::is_empty(directory));
+    std::filesystem::remove(directory);
+}
+
+TEST_CASE("seq::hash_join", "[seq][join][hash_join]")
+{
+    struct user
+    {
+        int id;
+        std::string name;
+    };
+    struct order
+    {
+        int user_id;
+        int amount;
+    };
+    const auto users = std::vector<user>{ { 1, "ann" }, { 2, "bob" }, { 3, "cid" }, { 1, "amy" } };
+    const auto orders = std::vector<order>{ { 2, 10 }, { 4, 20 }, { 1, 30 }, { 3, 40 }, { 2, 50 } };
+    const auto describe = seq::transform([](const auto& pair) { return std::to_string(pair.first.amount) + ":" + pair.second.name; });
+
+    REQUIRE_THAT(orders |= seq::hash_join(users, &user::id, &order::user_id) |= describe, EqualsRange(std::vector{ "10:bob"s, "30:ann"s, "30:amy"s, "40:cid"s, "50:bob"s }));
+
+    const auto pairs = orders |= seq::hash_join(users, &user::id, &order::user_id);
+    const auto [first_order, first_user] = *pairs.begin();
+    REQUIRE(&first_order == &orders[0]);
+    REQUIRE(&first_user == &users[1]);
+
+    const auto describe_left = seq::transform([](const auto& pair) { return std::to_string(pair.first.amount) + ":" + (pair.second ? pair.second->get().name : "-"); });
+    REQUIRE_THAT(orders |= seq::hash_left_join(users, &user::id, &order::user_id) |= describe_left, EqualsRange(std::vector{ "10:bob"s, "20:-"s, "30:ann"s, "30:amy"s, "40:cid"s, "50:bob"s }));
+
+    const auto amounts = seq::transform(&order::amount);
+    REQUIRE_THAT(orders |= seq::hash_semi_join(users, &user::id, &order::user_id) |= amounts, EqualsRange(std::vector{ 10, 30, 40, 50 }));
+
+    const auto squares = seq::iota(0, 2000) |= seq::transform([](int x) { return x * x; });
+    const auto joined = seq::iota(0, 100) |= seq::hash_join(squares, [](int x) { return x % 1024; }, identity);
+    const auto expected_size = std::count_if(squares.begin(), squares.end(), [](int x) { return x % 1024 < 100; });
+    REQUIRE(std::distance(joined.begin(), joined.end()) == expected_size);
+    REQUIRE(std::all_of(joined.begin(), joined.end(), [](const auto& pair) { return pair.second % 1024 == pair.first; }));
+
+    // probe keys of another type are hashed as the build keys
+    const auto names = std::vector{ "ann"s, "bob"s, "cid"s };
+    const auto lookups = std::vector<const char*>{ "bob", "zed", "ann" };
+    REQUIRE_THAT(lookups |= seq::hash_semi_join(names, identity, identity) |= seq::transform([](const char* x) { return std::string{ x }; }), EqualsRange(std::vector{ "bob"s, "ann"s }));
+}
+
+TEST_CASE("seq::merge_join", "[seq][join][merge_join]")
+{
+    const auto build = std::vector<std::pair<int, char>>{ { 1, 'a' }, { 2, 'b' }, { 2, 'c' }, { 4, 'd' }, { 6, 'e' } };
+    const auto probe = std::vector{ 0, 2, 2, 3, 4, 7 };
+    const auto join = seq::merge_join(build, get_first, identity) |= seq::transform([](const auto& pair) { return std::pair{ pair.first, pair.second.second }; });
+    REQUIRE_THAT(probe |= join, EqualsRange(std::vector<std::pair<int, char>>{ { 2, 'b' }, { 2, 'c' }, { 2, 'b' }, { 2, 'c' }, { 4, 'd' } }));
+    REQUIRE_THAT(std::vector<int>{} |= join, EqualsRange(std::vector<std::pair<int, char>>{}));
+
+    const auto [p, b] = *(probe |= seq::merge_join(build, get_first, identity)).begin();
+    REQUIRE(&p == &probe[1]);
+    REQUIRE(&b == &build[1]);
+
+    std::stringstream ss{ "6 4 1" };
+    const auto descending = std::vector{ 6, 5, 4, 3 };
+    REQUIRE_THAT(seq::istream<int>(ss) |= seq::merge_join(descending, identity, identity, std::greater<>{}) |= seq::transform(get_second), EqualsRange(std::vector{ 6, 4 }));
+
+    // the probe key is projected from a prvalue element
+    const auto names = std::vector{ std::string(20, 'b'), std::string(20, 'd') };
+    const auto computed = seq::iota(0, 5) |= seq::transform([](int x) { return std::pair{ std::string(20, 'a' + x), x }; });
+    REQUIRE_THAT(computed |= seq::merge_join(names, identity, get_first) |= seq::transform([](const auto& pair) { return pair.first.second; }), EqualsRange(std::vector{ 1, 3 }));
+}
+
+TEST_CASE("seq::cache_all", "[seq][cache_all]")
+{
+    int calls = 0;
+    const auto squares = seq::iota(0, 1000) |= seq::transform([&](int x) { return ++calls, x * x; }) |= seq::cache_all;
+    REQUIRE_THAT(squares |= seq::take(3), EqualsRange(std::vector{ 0, 1, 4 }));
+    REQUIRE(calls <= 4);
+    REQUIRE(std::accumulate(squares.begin(), squares.end(), 0L) == 332833500L);
+    REQUIRE(std::accumulate(squares.begin(), squares.end(), 0L) == 332833500L);
+    REQUIRE(calls == 1000);
+
+    const auto first = squares.begin();
+    const auto tenth = std::next(first, 10);
+    REQUIRE(&*std::next(first, 10) == &*tenth);
+    REQUIRE(*tenth == 100);
+
+    std::stringstream ss{ "3 1 2" };
+    const auto numbers = seq::istream<int>(ss) |= seq::cache_all;
+    REQUIRE(std::is_same_v<std::iterator_traits<decltype(numbers.begin())>::iterator_category, std::forward_iterator_tag>);
+    REQUIRE(*std::max_element(numbers.begin(), numbers.end()) == 3);
+    REQUIRE_THAT(numbers, EqualsRange(std::vector{ 3, 1, 2 }));
+    REQUIRE_THAT(numbers |= seq::adjacent<2> |= seq::transform(get_second), EqualsRange(std::vector{ 1, 2 }));
+    REQUIRE_THAT(std::vector<int>{} |= seq::memoize, EqualsRange(std::vector<int>{}));
+}
+
+TEST_CASE("seq - stages holding large callables", "[seq][fn_ref]")
+{
+    struct counted_pred
+    {
+        int* copies;
+
+        counted_pred(int* copies)
+            : copies{ copies }
+        {
+        }
+
+        counted_pred(const counted_pred& other)
+            : copies{ other.copies }
+        {
+            ++*copies;
+        }
+
+        counted_pred(counted_pred&&) = default;
+
+        bool operator()(int x) const
+        {
+            return x % 2 == 0;
+        }
+    };
+
+    struct counted_fn : counted_pred
+    {
+        using counted_pred::counted_pred;
+
+        int operator()(int x) const
+        {
+            return x;
+        }
+
+        int operator()(int x, int y) const
+        {
+            return x + y;
+        }
+    };
+
+    int copies = 0;
+    const auto values = std::vector{ 1, 2, 3, 4 };
+    const auto evens = std::vector{ 2, 4 };
+
+    REQUIRE_THAT(values |= seq::filter(counted_pred{ &copies }), EqualsRange(evens));
+    REQUIRE_THAT(values |= seq::transform(identity) |= seq::filter(counted_pred{ &copies }) |= seq::to_vector, EqualsRange(evens));
+    REQUIRE_THAT(values |= seq::take_while(counted_pred{ &copies }), EqualsRange(std::vector<int>{}));
+    REQUIRE_THAT(values |= seq::drop_while(counted_pred{ &copies }), EqualsRange(values));
+    REQUIRE_THAT(values |= seq::chunk_by_key(counted_pred{ &copies }) |= seq::transform(seq::to_vector), EqualsRange(std::vector<std::vector<int>>{ { 1 }, { 2 }, { 3 }, { 4 } }));
+    REQUIRE_THAT(values |= seq::window_aggregate(2, counted_fn{ &copies }), EqualsRange(std::vector{ 3, 5, 7 }));
+    REQUIRE((values |= seq::hash_join(values, counted_fn{ &copies }, counted_fn{ &copies }) |= seq::distance) == 4);
+    REQUIRE_THAT(values |= seq::hash_semi_join(evens, counted_fn{ &copies }, counted_fn{ &copies }), EqualsRange(evens));
+    REQUIRE(copies == 0);
+
+    const auto pred = counted_pred{ &copies };
+    const auto by_ref = seq::filter(fn_ref(pred));
+    const auto shared = seq::filter(fn_shared(counted_pred{ &copies }));
+    for (int i = 0; i < 3; ++i)
+    {
+        REQUIRE_THAT(values |= by_ref, EqualsRange(evens));
+        REQUIRE_THAT(values |= shared, EqualsRange(evens));
+        REQUIRE_THAT(values |= seq::filter(std::cref(pred)), EqualsRange(evens));
+    }
+    REQUIRE(copies == 0);
+
+    const auto stored = seq::filter(pred);
+    REQUIRE(copies == 1);
+    REQUIRE_THAT(values |= stored, EqualsRange(evens));
+    REQUIRE(copies == 2);
+
+    REQUIRE_THAT(std::forward_as_tuple(values, values) >>= seq::zip_transform(fn_shared(std::plus<>{})), EqualsRange(std::vector{ 2, 4, 6, 8 }));
+}
+
+template <class Range>
+constexpr bool has_trivially_copyable_iterator = std::is_trivially_copyable_v<iterator_t<const Range>>;
+
+template <class Range>
+constexpr std::size_t iterator_size = sizeof(iterator_t<const Range>);
+
+TEST_CASE("seq - trivially copyable iterators", "[seq][iterator]")
+{
+    const std::vector<int> values = { 1, 2, 3, 4 };
+    const auto square = [](int x) { return x * x; };
+    const auto even = [](int x) { return x % 2 == 0; };
+
+    const auto transformed = values |= seq::transform(square) |= seq::filter(even);
+    STATIC_REQUIRE(has_trivially_copyable_iterator<decltype(transformed)>);
+    STATIC_REQUIRE(iterator_size<decltype(transformed)> == 3 * sizeof(void*));
+
+    const auto taken = seq::iota(0, 10) |= seq::transform(square) |= seq::filter(even) |= seq::take(3);
+    STATIC_REQUIRE(has_trivially_copyable_iterator<decltype(taken)>);
+    REQUIRE_THAT(taken, EqualsRange(std::vector{ 0, 4, 16 }));
+
+    const auto zipped = seq::zip(values, values);
+    STATIC_REQUIRE(has_trivially_copyable_iterator<decltype(zipped)>);
+    STATIC_REQUIRE(iterator_size<decltype(zipped)> == 3 * sizeof(void*));
+
+    const auto joined = values |= seq::transform_join([&](int) { return all(values); });
+    STATIC_REQUIRE(has_trivially_copyable_iterator<decltype(joined)>);
+
+    STATIC_REQUIRE(has_trivially_copyable_iterator<decltype(values |= seq::chunk(2))>);
+    STATIC_REQUIRE(has_trivially_copyable_iterator<decltype(values |= seq::split_on_element(2))>);
+
+    // a generator that is default constructible and assignable is stored in the iterator as it is
+    struct counter
+    {
+        int n = 0;
+
+        std::optional<int> operator()()
+        {
+            return n < 3 ? std::optional{ n++ } : std::nullopt;
+        }
+    };
+    const auto generated = seq::generate(counter{});
+    STATIC_REQUIRE(has_trivially_copyable_iterator<decltype(generated)>);
+    REQUIRE_THAT(generated, EqualsRange(std::vector{ 0, 1, 2 }));
+    REQUIRE_THAT(generated, EqualsRange(std::vector{ 0, 1, 2 }));
+}
+
+TEST_CASE("seq::explain", "[seq][explain]")
+{
+    const std::vector<int> values = { 1, 2, 3, 4 };
+    const auto square = [](int x) { return x * x; };
+    const auto even = [](int x) { return x % 2 == 0; };
+
+    const auto description = seq::explain(values |= seq::transform(square) |= seq::filter(even));
+    REQUIRE(description.stages.size() == 4);
+    REQUIRE(description.downgraded());
+
+    const auto& source = description.stages[0];
+    REQUIRE(source.category == seq::iterator_kind::random_access);
+    REQUIRE(source.sized);
+    REQUIRE(source.contiguous);
+    REQUIRE(!source.borrowed);
+
+    const auto& ref = description.stages[1];
+    REQUIRE(ref.name == "ref");
+    REQUIRE(ref.borrowed);
+    REQUIRE(!ref.shared_owner);
+
+    const auto& transform = description.stages[2];
+    REQUIRE(transform.name == "seq::transform");
+    REQUIRE(transform.category == seq::iterator_kind::random_access);
+    REQUIRE(!transform.downgraded);
+    REQUIRE(transform.sized);
+    REQUIRE(!transform.contiguous);
+
+    const auto& filter = description.stages[3];
+    REQUIRE(filter.name == "seq::filter");
+    REQUIRE(filter.category == seq::iterator_kind::bidirectional);
+    REQUIRE(filter.downgraded);
+    REQUIRE(!filter.sized);
+    REQUIRE(filter.borrowed);
+    REQUIRE(filter.iterator_size == 3 * sizeof(void*));
+    REQUIRE(filter.trivially_copyable_iterator);
+
+    const auto owned = seq::explain(std::vector<int>{ 1, 2 } |= seq::transform(square));
+    REQUIRE(owned.stages.size() == 3);
+    REQUIRE(owned.stages[1].name == "owning");
+    REQUIRE(owned.stages[1].shared_owner);
+    REQUIRE(!owned.stages[2].borrowed);
+    REQUIRE(!owned.downgraded());
+
+    const auto zipped = seq::explain(seq::zip(values, seq::iota(0)));
+    REQUIRE(zipped.stages.size() == 4);
+    REQUIRE(zipped.stages[2].name == "seq::iota");
+    REQUIRE(zipped.stages[3].inputs == 2);
+
+    std::ostringstream os;
+    os << description;
+    REQUIRE(os.str().find("seq::filter: bidirectional (downgraded)") != std::string::npos);
+
+    seq::warn_category_downgrades(values |= seq::transform(square));
+}
+
+template <class Range>
+int sum_of(const Range& range)
+{
+    int result = 0;
+    for (auto&& item : range)
+    {
+        result += item;
+    }
+    return result;
+}
+
+TEST_CASE("seq - allocations of the core adaptors", "[seq][allocations]")
+{
+    const std::vector<int> values = { 1, 2, 3, 4, 5, 6 };
+    const std::vector<std::vector<int>> nested = { { 1, 2 }, {}, { 3 } };
+    const auto square = [](int x) { return x * x; };
+    const auto even = [](int x) { return x % 2 == 0; };
+    const auto first = [](const auto& item) { return std::get<0>(item); };
+
+    REQUIRE_NO_ALLOCATIONS(sum_of(values |= seq::transform(square)));
+    REQUIRE_NO_ALLOCATIONS(sum_of(values |= seq::filter(even)));
+    REQUIRE_NO_ALLOCATIONS(sum_of(values |= seq::transform(square) |= seq::filter(even) |= seq::take(2)));
+    REQUIRE_NO_ALLOCATIONS(sum_of(values |= seq::drop(2) |= seq::stride(2)));
+    REQUIRE_NO_ALLOCATIONS(sum_of(values |= seq::take_while(even) |= seq::drop_while(even)));
+    REQUIRE_NO_ALLOCATIONS(sum_of(values |= seq::reverse));
+    REQUIRE_NO_ALLOCATIONS(sum_of(seq::iota(0, 10) |= seq::transform(square)));
+    REQUIRE_NO_ALLOCATIONS(sum_of(seq::zip(values, values) |= seq::transform(first)));
+    REQUIRE_NO_ALLOCATIONS(sum_of(values |= seq::enumerate |= seq::transform(first)));
+    REQUIRE_NO_ALLOCATIONS(sum_of(nested |= seq::join));
+    REQUIRE_NO_ALLOCATIONS(sum_of(values |= seq::transform_join([&](int) { return all(values); })));
+    REQUIRE_NO_ALLOCATIONS(sum_of(values |= seq::chunk(4) |= seq::transform([](const auto& chunk) { return sum_of(chunk); })));
+
+    // all() of an rvalue moves it into a shared_ptr
+    REQUIRE(count_allocations([&]() { sum_of(std::vector<int>{ 1, 2, 3 } |= seq::transform(square)); }) > 1);
+    REQUIRE_ALLOCATIONS_AT_MOST(2u, sum_of(std::vector<int>{ 1, 2, 3 } |= seq::transform(square)));
+}
+
+TEST_CASE("seq::match", "[seq][match]")
+{
+    const std::vector<std::variant<int, std::string>> items = { 1, "ab"s, 3, "cde"s };
+    REQUIRE_THAT(
+        items |= seq::match([](int x) { return x * 10; }, [](const std::string& s) { return static_cast<int>(s.size()); }),
+        EqualsRange(std::vector{ 10, 2, 30, 3 }));
+}
+
+TEST_CASE("seq::bucket_by_alternative", "[seq][bucket_by_alternative]")
+{
+    using event = std::variant<int, double, std::string>;
+    const std::vector<event> events = { 1, 2.5, "a"s, 2, 3, "b"s, 0.5 };
+
+    std::vector<std::vector<int>> ints;
+    std::vector<std::vector<double>> doubles;
+    std::vector<std::vector<std::string>> strings;
+    const auto ints_of = [&](const_span<int> items) { ints.emplace_back(items.begin(), items.end()); };
+    const auto doubles_of = [&](const_span<double> items) { doubles.emplace_back(items.begin(), items.end()); };
+    const auto strings_of = [&](const_span<std::string> items) { strings.emplace_back(items.begin(), items.end()); };
+
+    events |= seq::bucket_by_alternative(ints_of, doubles_of, strings_of);
+    REQUIRE(ints == std::vector<std::vector<int>>{ { 1, 2, 3 } });
+    REQUIRE(doubles == std::vector<std::vector<double>>{ { 2.5, 0.5 } });
+    REQUIRE(strings == std::vector<std::vector<std::string>>{ { "a", "b" } });
+
+    ints.clear();
+    doubles.clear();
+    strings.clear();
+    events |= seq::bucket_by_alternative_batched(3, ints_of, doubles_of, strings_of);
+    REQUIRE(ints == std::vector<std::vector<int>>{ { 1 }, { 2, 3 } });
+    REQUIRE(doubles == std::vector<std::vector<double>>{ { 2.5 }, { 0.5 } });
+    REQUIRE(strings == std::vector<std::vector<std::string>>{ { "a" }, { "b" } });
+
+    ints.clear();
+    std::vector<event>{} |= seq::bucket_by_alternative(ints_of, doubles_of, strings_of);
+    REQUIRE(ints.empty());
+    REQUIRE_THROWS_AS(seq::bucket_by_alternative_batched(0, ints_of, doubles_of, strings_of), std::invalid_argument);
+}
+
+TEST_CASE("seq::transform_res", "[seq][res][transform_res]")
+{
+    int calls = 0;
+    const auto parse = [&](const std::string& text) -> result<int, std::string>
+    {
+        ++calls;
+        if (text.empty() || !std::all_of(text.begin(), text.end(), [](char c) { return std::isdigit(c); }))
+        {
+            return error("not a number: " + text);
+        }
+        return std::stoi(text);
+    };
+
+    const std::vector<std::string> valid = { "1", "22", "333" };
+    REQUIRE((valid |= seq::transform_res(parse) |= seq::collect_result) == result<std::vector<int>, std::string>{ std::vector{ 1, 22, 333 } });
+
+    const std::vector<std::string> invalid = { "1", "x", "3", "y" };
+    const auto results = invalid |= seq::transform_res(parse) |= seq::to_vector;
+    REQUIRE(results.size() == 2);
+    REQUIRE(*results[0] == 1);
+    REQUIRE(results[1].error() == "not a number: x");
+
+    calls = 0;
+    REQUIRE((invalid |= seq::transform_res(parse) |= seq::collect_result) == error("not a number: x"s));
+    REQUIRE(calls == 2);
+    REQUIRE((std::vector<std::string>{} |= seq::transform_res(parse) |= seq::collect_result)->empty());
+
+    const auto pairs = valid |= seq::transform_res(parse) |= seq::pairwise |= seq::to_vector;
+    REQUIRE(pairs.size() == 2);
+    REQUIRE(*std::get<0>(pairs[1]) == 22);
+    REQUIRE(*std::get<1>(pairs[1]) == 333);
+    const auto parsed = valid |= seq::transform_res(parse);
+    STATIC_REQUIRE(std::is_same_v<iterator_category_of<decltype(parsed)>, std::input_iterator_tag>);
+    auto it = parsed.begin();
+    REQUIRE(**it++ == 1);
+    REQUIRE(**it == 22);
+}
+
+TEST_CASE("seq::maybe_accumulate", "[seq][accumulate]")
+{
+    REQUIRE((seq::range(1, 101) |= seq::maybe_accumulate(std::plus<>{})) == 5050);
+    REQUIRE(!(std::vector<int>{} |= seq::maybe_accumulate(std::plus<>{})));
+}
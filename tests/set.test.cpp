@@ -1,5 +1,6 @@
 #include <catch2/catch_test_macros.hpp>
 #include <cpp_pipelines/set.hpp>
+#include <random>
 
 using namespace cpp_pipelines;
 using namespace std::string_literals;
@@ -27,3 +28,48 @@ TEST_CASE("set::includes", "[set]")
     REQUIRE(set::includes(std::set{ 1, 2, 3 }, std::set{ 3 }) == true);
     REQUIRE(set::includes(std::set{ 1, 2, 3 }, std::set{ 2, 4, 5 }) == false);
 }
+
+TEST_CASE("set operations - flat_set", "[set][flat_set]")
+{
+    REQUIRE(set::sum<flat_set>(std::vector{ 1, 2, 3 }, std::vector{ 2, 4, 5 }) == flat_set{ 1, 2, 3, 4, 5 });
+    REQUIRE(set::difference<flat_set>(std::vector{ 1, 2, 3 }, std::vector{ 2, 4, 5 }) == flat_set{ 1, 3 });
+    REQUIRE(set::intersection<flat_set>(std::vector{ 1, 2, 3 }, std::vector{ 2, 4, 5 }) == flat_set{ 2 });
+}
+
+TEST_CASE("flat_set", "[set][flat_set]")
+{
+    auto s = flat_set<int>{ 5, 3, 1, 3, 4 };
+    REQUIRE(s.container() == std::vector{ 1, 3, 4, 5 });
+    REQUIRE(s.contains(3));
+    REQUIRE(!s.contains(2));
+    REQUIRE(s.insert(2).second);
+    REQUIRE(!s.insert(2).second);
+    REQUIRE(s.erase(4) == 1);
+    REQUIRE(s.container() == std::vector{ 1, 2, 3, 5 });
+    REQUIRE(flat_set<int>{ sorted_unique, { 1, 2, 3 } }.container() == std::vector{ 1, 2, 3 });
+}
+
+TEST_CASE("set::intersection - contiguous integers", "[set]")
+{
+    std::mt19937 generator{ 7 };
+    for (const auto& [n, m] : { std::pair{ 1000, 1000 }, std::pair{ 10, 5000 }, std::pair{ 3000, 17 }, std::pair{ 0, 100 } })
+    {
+        const auto random_set = [&](int size) {
+            std::set<std::uint32_t> result;
+            while (static_cast<int>(result.size()) < size)
+            {
+                result.insert(generator() % 20000);
+            }
+            return std::vector<std::uint32_t>(result.begin(), result.end());
+        };
+        const auto a = random_set(n);
+        const auto b = random_set(m);
+        const auto expected = set::intersection(std::set<std::uint32_t>(a.begin(), a.end()), std::set<std::uint32_t>(b.begin(), b.end()));
+        REQUIRE(set::intersection(a, b) == expected);
+        REQUIRE(set::intersection<flat_set>(a, b).container() == std::vector<std::uint32_t>(expected.begin(), expected.end()));
+
+        const auto a64 = std::vector<std::int64_t>(a.begin(), a.end());
+        const auto b64 = std::vector<std::int64_t>(b.begin(), b.end());
+        REQUIRE(set::intersection(a64, b64) == std::set<std::int64_t>(expected.begin(), expected.end()));
+    }
+}
@@ -0,0 +1,118 @@
+#include <catch2/catch_test_macros.hpp>
+#include <cpp_pipelines/seq.hpp>
+#include <cpp_pipelines/seq/stats.hpp>
+#include <cmath>
+#include <random>
+
+using namespace cpp_pipelines;
+
+TEST_CASE("stats::moments", "[stats][moments]")
+{
+    const auto values = std::vector{ 2.0, 4.0, 4.0, 4.0, 5.0, 5.0, 7.0, 9.0 };
+    const stats::moments result = values |= seq::stats(stats::moments{});
+    REQUIRE(result.count() == 8);
+    REQUIRE(result.mean() == 5.0);
+    REQUIRE(result.variance() == 4.0);
+    REQUIRE(result.stddev() == 2.0);
+    REQUIRE(result.min() == 2.0);
+    REQUIRE(result.max() == 9.0);
+
+    stats::moments first;
+    stats::moments second;
+    for (std::size_t i = 0; i < values.size(); ++i)
+    {
+        (i < 3 ? first : second).push(values[i]);
+    }
+    first.merge(second);
+    REQUIRE(first.count() == 8);
+    REQUIRE(std::abs(first.mean() - 5.0) < 1e-12);
+    REQUIRE(std::abs(first.variance() - 4.0) < 1e-12);
+    REQUIRE(std::isnan(stats::moments{}.mean()));
+}
+
+TEST_CASE("stats::quantiles", "[stats][quantiles]")
+{
+    std::mt19937 generator{ 3 };
+    std::vector<double> values(100000);
+    std::generate(values.begin(), values.end(), [&]() { return std::exponential_distribution<>{ 1.0 }(generator); });
+
+    stats::quantiles first;
+    stats::quantiles second;
+    for (std::size_t i = 0; i < values.size(); ++i)
+    {
+        (i % 2 == 0 ? first : second).push(values[i]);
+    }
+    first.merge(second);
+
+    std::sort(values.begin(), values.end());
+    for (const double q : { 0.01, 0.5, 0.9, 0.99, 0.999 })
+    {
+        const double estimate = first.quantile(q);
+        const double rank = static_cast<double>(std::lower_bound(values.begin(), values.end(), estimate) - values.begin());
+        REQUIRE(std::abs(rank / values.size() - q) < 0.005);
+    }
+    REQUIRE(first.quantile(0.0) == values.front());
+    REQUIRE(first.quantile(1.0) == values.back());
+    REQUIRE(first.count() == 100000);
+}
+
+TEST_CASE("stats::distinct_count", "[stats][distinct_count]")
+{
+    stats::distinct_count first;
+    stats::distinct_count second;
+    for (int i = 0; i < 100000; ++i)
+    {
+        first.push(i % 50000);
+        second.push(i + 25000);
+    }
+    REQUIRE(std::abs(first.estimate() / 50000 - 1) < 0.05);
+    first.merge(second);
+    REQUIRE(std::abs(first.estimate() / 125000 - 1) < 0.05);
+
+    stats::distinct_count small;
+    for (const char* word : { "a", "b", "c", "a" })
+    {
+        small.push(std::string{ word });
+    }
+    REQUIRE(std::round(small.estimate()) == 3);
+    REQUIRE_THROWS_AS(small.merge(stats::distinct_count{ 10 }), std::invalid_argument);
+}
+
+TEST_CASE("stats::heavy_hitters", "[stats][heavy_hitters]")
+{
+    std::mt19937 generator{ 9 };
+    std::vector<int> values;
+    for (int i = 0; i < 20000; ++i)
+    {
+        values.push_back(i % 4 == 0 ? static_cast<int>(i % 3) : static_cast<int>(generator() % 100000) + 10);
+    }
+
+    stats::heavy_hitters<int> first{ 32 };
+    stats::heavy_hitters<int> second{ 32 };
+    for (std::size_t i = 0; i < values.size(); ++i)
+    {
+        (i < values.size() / 3 ? first : second).push(values[i]);
+    }
+    first.merge(second);
+
+    const auto top = first.top();
+    REQUIRE(top.size() == 32);
+    std::vector<int> items = { top[0].item, top[1].item, top[2].item };
+    std::sort(items.begin(), items.end());
+    REQUIRE(items == std::vector{ 0, 1, 2 });
+    for (std::size_t i = 0; i < 3; ++i)
+    {
+        const auto exact = static_cast<std::uint64_t>(std::count(values.begin(), values.end(), top[i].item));
+        REQUIRE(top[i].count >= exact);
+        REQUIRE(top[i].count - top[i].error <= exact);
+    }
+}
+
+TEST_CASE("seq::stats", "[stats][seq]")
+{
+    const auto values = std::vector{ 1, 2, 2, 3, 3, 3 };
+    const auto [moments, distinct, hitters] = values |= seq::stats(stats::moments{}, stats::distinct_count{}, stats::heavy_hitters<int>{ 2 });
+    REQUIRE(moments.mean() == 14.0 / 6);
+    REQUIRE(std::round(distinct.estimate()) == 3);
+    REQUIRE(hitters.top().front().item == 3);
+}
@@ -4,6 +4,7 @@
 #include <catch2/matchers/catch_matchers_templated.hpp>
 #include <cpp_pipelines/output.hpp>
 #include <cpp_pipelines/view_interface.hpp>
+#include <cstddef>
 #include <utility>
 
 namespace std
@@ -50,6 +51,26 @@ auto EqualsRange(const Range& range) -> EqualsRangeMatcher<Range>
     return EqualsRangeMatcher<Range>{ range };
 }
 
+// number of calls to the global operator new made by the current thread (see allocation_counter.cpp)
+std::size_t& allocation_count();
+
+template <class Func>
+std::size_t count_allocations(Func&& func)
+{
+    const std::size_t before = allocation_count();
+    std::forward<Func>(func)();
+    return allocation_count() - before;
+}
+
+#define REQUIRE_ALLOCATIONS_AT_MOST(n, ...)                                                 \
+    do                                                                                      \
+    {                                                                                       \
+        const std::size_t allocations_ = count_allocations([&]() { (void)(__VA_ARGS__); }); \
+        REQUIRE(allocations_ <= (n));                                                       \
+    } while (false)
+
+#define REQUIRE_NO_ALLOCATIONS(...) REQUIRE_ALLOCATIONS_AT_MOST(0u, __VA_ARGS__)
+
 namespace cpp_pipelines
 {
 template <class Impl>
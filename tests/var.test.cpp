@@ -1,6 +1,8 @@
 #include <catch2/catch_test_macros.hpp>
 #include <cpp_pipelines/output.hpp>
 #include <cpp_pipelines/var.hpp>
+#include <string>
+#include <utility>
 
 using namespace cpp_pipelines;
 using namespace std::string_literals;
@@ -10,3 +12,62 @@ TEST_CASE("var", "[res]")
     REQUIRE((std::variant<int, char>{ 3 } |= var::match([](int) { return 1; }, [](char) { return 2; })) == 1);
     REQUIRE((std::variant<int, char>{ 'x' } |= var::match([](int) { return 1; }, [](char) { return 2; })) == 2);
 }
+
+TEST_CASE("var::visit", "[var][visit]")
+{
+    using variant_type = std::variant<int, double, std::string>;
+    const auto describe = var::overloaded{ [](int) { return "int"s; },
+                                           [](double) { return "double"s; },
+                                           [](const std::string& s) { return "string " + s; } };
+    REQUIRE(var::visit(describe, variant_type{ 1 }) == "int");
+    REQUIRE(var::visit(describe, variant_type{ 1.5 }) == "double");
+    REQUIRE(var::visit(describe, variant_type{ "x"s }) == "string x");
+
+    variant_type item = 3;
+    var::visit([](auto& value) { value = value + value; }, item);
+    REQUIRE(std::get<int>(item) == 6);
+
+    std::string moved = var::visit(
+        var::overloaded{ [](std::string&& s) { return std::move(s); }, [](auto&&) { return ""s; } },
+        variant_type{ "abc"s });
+    REQUIRE(moved == "abc");
+
+    struct throwing
+    {
+        throwing() = default;
+        throwing(const throwing&)
+        {
+            throw 0;
+        }
+    };
+    std::variant<int, throwing> valueless;
+    try
+    {
+        valueless.emplace<throwing>(throwing{});
+    }
+    catch (int)
+    {
+    }
+    REQUIRE(valueless.valueless_by_exception());
+    REQUIRE_THROWS_AS(var::visit([](auto&&) {}, valueless), std::bad_variant_access);
+}
+
+template <std::size_t I>
+struct alternative
+{
+    int value;
+};
+
+template <std::size_t... I>
+auto make_wide_variant(std::index_sequence<I...>) -> std::variant<alternative<I>...>;
+
+template <std::size_t Size>
+using wide_variant = decltype(make_wide_variant(std::make_index_sequence<Size>{}));
+
+TEST_CASE("var::visit - many alternatives", "[var][visit]")
+{
+    const auto value = [](const auto& item) { return item.value; };
+    REQUIRE(var::visit(value, wide_variant<32>{ std::in_place_index<31>, alternative<31>{ 7 } }) == 7);
+    REQUIRE(var::visit(value, wide_variant<32>{ std::in_place_index<0>, alternative<0>{ 1 } }) == 1);
+    REQUIRE(var::visit(value, wide_variant<40>{ std::in_place_index<35>, alternative<35>{ 5 } }) == 5);
+}